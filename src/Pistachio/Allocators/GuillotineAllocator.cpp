@@ -0,0 +1,211 @@
+#include "ptpch.h"
+#include "GuillotineAllocator.h"
+#include <algorithm>
+#include <bit>
+namespace Pistachio
+{
+	GuillotineAllocator::GuillotineAllocator(iVector2 max_size, iVector2 portion_size)
+	{
+		PT_CORE_ASSERT(!(max_size.x % portion_size.x));
+		PT_CORE_ASSERT(!(max_size.y % portion_size.y));
+		m_portion_size = portion_size;
+		m_size = { max_size.x / portion_size.x, max_size.y / portion_size.y };
+		Reset();
+	}
+	uint32_t GuillotineAllocator::SizeClass(uint32_t w, uint32_t h)
+	{
+		return std::min((uint32_t)std::bit_width(std::min(w, h)) - 1, NumClasses - 1);
+	}
+	uint64_t GuillotineAllocator::EdgeKey(uint32_t line, uint32_t start, uint32_t length)
+	{
+		PT_CORE_ASSERT(line < (1u << 21) && start < (1u << 21) && length < (1u << 21));
+		return ((uint64_t)line << 42) | ((uint64_t)start << 21) | length;
+	}
+	uint64_t GuillotineAllocator::EdgeKey(Edge edge, const Rect& r)
+	{
+		switch (edge)
+		{
+		case Left: return EdgeKey(r.x, r.y, r.h);
+		case Right: return EdgeKey(r.x + r.w, r.y, r.h);
+		case Bottom: return EdgeKey(r.y, r.x, r.w);
+		default: return EdgeKey(r.y + r.h, r.x, r.w);
+		}
+	}
+	void GuillotineAllocator::Reset()
+	{
+		m_free = FreeSpace();
+		AddFree({ 0, 0, m_size.x, m_size.y });
+	}
+	void GuillotineAllocator::AddFree(Rect r)
+	{
+		uint32_t slot;
+		if (m_free.unusedSlots.size())
+		{
+			slot = m_free.unusedSlots.back();
+			m_free.unusedSlots.pop_back();
+		}
+		else
+		{
+			slot = (uint32_t)m_free.rects.size();
+			m_free.rects.emplace_back();
+		}
+		auto& bucket = m_free.buckets[SizeClass(r.w, r.h)];
+		m_free.rects[slot] = { r, (uint32_t)bucket.size() };
+		bucket.push_back(slot);
+		//free rectangles are disjoint, no two share an edge on the same line with the same span
+		for (uint32_t e = 0; e < NumEdges; e++) m_free.edges[e][EdgeKey((Edge)e, r)] = slot;
+		m_free.numRects++;
+	}
+	void GuillotineAllocator::RemoveFree(uint32_t slot)
+	{
+		const FreeRect& f = m_free.rects[slot];
+		auto& bucket = m_free.buckets[SizeClass(f.rect.w, f.rect.h)];
+		bucket[f.bucketIndex] = bucket.back();
+		m_free.rects[bucket.back()].bucketIndex = f.bucketIndex;
+		bucket.pop_back();
+		for (uint32_t e = 0; e < NumEdges; e++) m_free.edges[e].erase(EdgeKey((Edge)e, f.rect));
+		m_free.unusedSlots.push_back(slot);
+		m_free.numRects--;
+	}
+	bool GuillotineAllocator::Place(uint32_t w, uint32_t h, Rect& out)
+	{
+		//a rectangle that fits has a shorter side at least as long as the request's, smaller classes can't hold it
+		for (uint32_t c = SizeClass(w, h); c < NumClasses; c++)
+		{
+			uint32_t best = UINT32_MAX, bestFit = UINT32_MAX;
+			for (uint32_t slot : m_free.buckets[c])
+			{
+				const Rect& r = m_free.rects[slot].rect;
+				if (r.w < w || r.h < h) continue;
+				//best short side fit, ties go to the rectangle nearest the origin so the packing stays tight
+				uint32_t fit = std::min(r.w - w, r.h - h);
+				const Rect* b = best == UINT32_MAX ? nullptr : &m_free.rects[best].rect;
+				if (fit < bestFit || (fit == bestFit && (r.y < b->y || (r.y == b->y && r.x < b->x))))
+				{
+					best = slot;
+					bestFit = fit;
+				}
+			}
+			if (best == UINT32_MAX) continue;
+			Rect r = m_free.rects[best].rect;
+			RemoveFree(best);
+			out = { r.x, r.y, w, h };
+			//cut along the longer leftover so the bigger of the two pieces stays as large as it can
+			uint32_t right = r.w - w, top = r.h - h;
+			if (right > top)
+			{
+				if (right) AddFree({ r.x + w, r.y, right, r.h });
+				if (top) AddFree({ r.x, r.y + h, w, top });
+			}
+			else
+			{
+				if (right) AddFree({ r.x + w, r.y, right, h });
+				if (top) AddFree({ r.x, r.y + h, r.w, top });
+			}
+			return true;
+		}
+		return false;
+	}
+	void GuillotineAllocator::Release(Rect r)
+	{
+		//a neighbour sharing a whole edge has its opposite edge on the same line with the same span
+		static constexpr Edge opposite[NumEdges] = { Right, Left, Top, Bottom };
+		bool merged = true;
+		while (merged)
+		{
+			merged = false;
+			for (uint32_t e = 0; e < NumEdges && !merged; e++)
+			{
+				auto it = m_free.edges[opposite[e]].find(EdgeKey((Edge)e, r));
+				if (it == m_free.edges[opposite[e]].end()) continue;
+				uint32_t slot = it->second;
+				const Rect n = m_free.rects[slot].rect;
+				if (e == Left || e == Right) r = { std::min(r.x, n.x), r.y, r.w + n.w, r.h };
+				else r = { r.x, std::min(r.y, n.y), r.w, r.h + n.h };
+				RemoveFree(slot);
+				merged = true;
+			}
+		}
+		AddFree(r);
+	}
+	uint32_t GuillotineAllocator::Allocate(iVector2 size, AllocatorFlags flags)
+	{
+		uint32_t w = (size.x + m_portion_size.x - 1) / m_portion_size.x;
+		uint32_t h = (size.y + m_portion_size.y - 1) / m_portion_size.y;
+		Rect rect;
+		if (!w || !h || !Place(w, h, rect))
+		{
+			if ((flags & AllocatorFlags::DownscaleOnFail) == AllocatorFlags::None) return 0;
+			if (size.x <= m_portion_size.x && size.y <= m_portion_size.y) return 0;
+			return Allocate(size / iVector2{ 2,2 }, AllocatorFlags::DownscaleOnFail);
+		}
+		id++;
+		while (id == 0 || m_allocations.find(id) != m_allocations.end()) id++; //check if the id is available
+		m_allocations[id] = rect;
+		return id;
+	}
+	void GuillotineAllocator::DeAllocate(uint32_t id)
+	{
+		if (id == 0) return;
+		auto findit = m_allocations.find(id);
+		if (findit == m_allocations.end()) return; //id doesnt exist
+		Release(findit->second);
+		m_allocations.erase(findit);
+	}
+	std::vector<RegionMove> GuillotineAllocator::DeFragment()
+	{
+		std::vector<RegionMove> moves;
+		std::vector<std::pair<uint32_t, Rect>> order(m_allocations.begin(), m_allocations.end());
+		//biggest first, ids break ties so the result doesn't depend on the map's order
+		std::sort(order.begin(), order.end(), [](const auto& a, const auto& b)
+			{
+				uint32_t areaA = a.second.w * a.second.h, areaB = b.second.w * b.second.h;
+				if (areaA != areaB) return areaA > areaB;
+				if (a.second.h != b.second.h) return a.second.h > b.second.h;
+				return a.first < b.first;
+			});
+		FreeSpace oldFree = m_free;
+		Reset();
+		std::vector<Rect> placed(order.size());
+		for (uint32_t i = 0; i < order.size(); i++)
+		{
+			if (Place(order[i].second.w, order[i].second.h, placed[i])) continue;
+			//the repack is worse than what's there, keep the current layout
+			m_free = std::move(oldFree);
+			return moves;
+		}
+		for (uint32_t i = 0; i < order.size(); i++)
+		{
+			const Rect& from = order[i].second;
+			m_allocations[order[i].first] = placed[i];
+			if (from.x != placed[i].x || from.y != placed[i].y)
+				moves.push_back({ order[i].first, ToRegion(from), ToRegion(placed[i]) });
+		}
+		return moves;
+	}
+	Region GuillotineAllocator::GetRegion(std::uint32_t id) const
+	{
+		if (id == 0) return Region();
+		auto findit = m_allocations.find(id);
+		if (findit == m_allocations.end()) return Region(); //id doesnt exist
+		return ToRegion(findit->second);
+	}
+	Region GuillotineAllocator::ToRegion(const Rect& r) const
+	{
+		return { { r.x * m_portion_size.x, r.y * m_portion_size.y }, { r.w * m_portion_size.x, r.h * m_portion_size.y } };
+	}
+	uint32_t GuillotineAllocator::GetLargestFreeArea() const
+	{
+		uint32_t largest = 0;
+		for (const auto& bucket : m_free.buckets)
+			for (uint32_t slot : bucket) largest = std::max(largest, m_free.rects[slot].rect.w * m_free.rects[slot].rect.h);
+		return largest;
+	}
+	uint32_t GuillotineAllocator::GetFreeArea() const
+	{
+		uint32_t area = 0;
+		for (const auto& bucket : m_free.buckets)
+			for (uint32_t slot : bucket) area += m_free.rects[slot].rect.w * m_free.rects[slot].rect.h;
+		return area;
+	}
+}
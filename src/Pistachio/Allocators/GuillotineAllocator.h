@@ -0,0 +1,85 @@
+#pragma once
+#include "Pistachio/Allocators/AtlasAllocator.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+namespace Pistachio
+{
+	//where DeFragment moved an allocation, the texels have to be copied (or redrawn) from @from to @to
+	struct PISTACHIO_API RegionMove
+	{
+		uint32_t id;
+		Region from;
+		Region to;
+	};
+	/*
+	* Guillotine rectangle packer, a drop in replacement for AtlasAllocator.
+	* The atlas is counted in portions, free space is a list of disjoint rectangles: an allocation takes the best
+	* fitting one and cuts what it doesn't use in two, freeing puts the rectangle back and merges it with the free
+	* neighbours it shares a whole edge with.
+	* Free rectangles are bucketed by the log2 of their shorter side, a request scans the buckets that can hold it,
+	* so allocating is linear in the free rectangles of those buckets (F at worst, usually far fewer).
+	* Every free rectangle is also indexed by its four edges, freeing finds each neighbour to merge with in one hash lookup,
+	* so it costs O(1) per merge instead of a scan of every free rectangle.
+	* Cuts can leave free space no request fits in, DeFragment repacks every allocation and reports the ones that moved.
+	*/
+	class PISTACHIO_API GuillotineAllocator
+	{
+	public:
+		GuillotineAllocator(iVector2 max_size, iVector2 portion_size);
+		//@size is rounded up to whole portions, returns 0 when nothing fits
+		uint32_t Allocate(iVector2 size, AllocatorFlags flags);
+		void DeAllocate(uint32_t id);
+		//repacks the allocations biggest first, ids stay valid, nothing moves when the repack wouldn't fit
+		std::vector<RegionMove> DeFragment();
+		Region GetRegion(std::uint32_t id) const;
+		inline iVector2 GetPortionSize() const { return m_portion_size; }
+		inline uint32_t GetTotalArea() const { return m_size.x * m_portion_size.x * m_size.y * m_portion_size.y; }
+		inline iVector2 GetMaxSize() const { return m_size; }
+		uint32_t GetNumAllocations() const { return (uint32_t)m_allocations.size(); }
+		uint32_t GetNumFreeRects() const { return m_free.numRects; }
+		//biggest free rectangle in portions, a request bigger than it fails even if there's enough free area
+		uint32_t GetLargestFreeArea() const;
+		//in portions
+		uint32_t GetFreeArea() const;
+	private:
+		//in portions
+		struct Rect
+		{
+			uint32_t x, y, w, h;
+		};
+		static constexpr uint32_t NumClasses = 16;
+		enum Edge : uint32_t { Left, Right, Bottom, Top, NumEdges };
+		struct FreeRect
+		{
+			Rect rect;
+			uint32_t bucketIndex;//where the slot sits in its size class' bucket
+		};
+		//kept in one place so DeFragment can put it back when the repack fails
+		struct FreeSpace
+		{
+			std::vector<FreeRect> rects;//slots, the unused ones are in unusedSlots
+			std::vector<uint32_t> unusedSlots;
+			std::vector<uint32_t> buckets[NumClasses];//slots by size class
+			//slot of the free rectangle with an edge on a line, keyed by the line and the edge's start and length
+			std::unordered_map<uint64_t, uint32_t> edges[NumEdges];
+			uint32_t numRects = 0;
+		};
+		static uint32_t SizeClass(uint32_t w, uint32_t h);
+		static uint64_t EdgeKey(uint32_t line, uint32_t start, uint32_t length);
+		static uint64_t EdgeKey(Edge edge, const Rect& r);
+		void AddFree(Rect r);
+		void RemoveFree(uint32_t slot);
+		//puts a freed rectangle back, merging it with its neighbours until none shares a whole edge with it
+		void Release(Rect r);
+		bool Place(uint32_t w, uint32_t h, Rect& out);
+		Region ToRegion(const Rect& r) const;
+		void Reset();
+	private:
+		uint32_t id = 0;
+		std::unordered_map<uint32_t, Rect> m_allocations;
+		FreeSpace m_free;
+		iVector2 m_portion_size = {};
+		iVector2 m_size = {};//in portions
+	};
+}
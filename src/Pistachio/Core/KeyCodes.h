@@ -1,142 +1,142 @@
-﻿#pragma once
-typedef int KeyCode;
-#define PT_KEY_UNKNOWN            -1
-
-//ripped straight from glfw
-#define PT_KEY_SPACE              32
-#define PT_KEY_APOSTROPHE         39  /* ' */
-#define PT_KEY_COMMA              44  /* , */
-#define PT_KEY_MINUS              45  /* - */
-#define PT_KEY_PERIOD             46  /* . */
-#define PT_KEY_SLASH              47  /* / */
-#define PT_KEY_0                  48
-#define PT_KEY_1                  49
-#define PT_KEY_2                  50
-#define PT_KEY_3                  51
-#define PT_KEY_4                  52
-#define PT_KEY_5                  53
-#define PT_KEY_6                  54
-#define PT_KEY_7                  55
-#define PT_KEY_8                  56
-#define PT_KEY_9                  57
-#define PT_KEY_SEMICOLON          59  /* ; */
-#define PT_KEY_EQUAL              61  /* = */
-#define PT_KEY_A                  65
-#define PT_KEY_B                  66
-#define PT_KEY_C                  67
-#define PT_KEY_D                  68
-#define PT_KEY_E                  69
-#define PT_KEY_F                  70
-#define PT_KEY_G                  71
-#define PT_KEY_H                  72
-#define PT_KEY_I                  73
-#define PT_KEY_J                  74
-#define PT_KEY_K                  75
-#define PT_KEY_L                  76
-#define PT_KEY_M                  77
-#define PT_KEY_N                  78
-#define PT_KEY_O                  79
-#define PT_KEY_P                  80
-#define PT_KEY_Q                  81
-#define PT_KEY_R                  82
-#define PT_KEY_S                  83
-#define PT_KEY_T                  84
-#define PT_KEY_U                  85
-#define PT_KEY_V                  86
-#define PT_KEY_W                  87
-#define PT_KEY_X                  88
-#define PT_KEY_Y                  89
-#define PT_KEY_Z                  90
-#define PT_KEY_LEFT_BRACKET       91  /* [ */
-#define PT_KEY_BACKSLASH          92  /* \ */
-#define PT_KEY_RIGHT_BRACKET      93  /* ] */
-#define PT_KEY_GRAVE_ACCENT       96  /* ` */
-#define PT_KEY_WORLD_1            161 /* non-US #1 */
-#define PT_KEY_WORLD_2            162 /* non-US #2 */
-
-/* Function keys */
-#define PT_KEY_ESCAPE             256
-#define PT_KEY_ENTER              257
-#define PT_KEY_TAB                258
-#define PT_KEY_BACKSPACE          259
-#define PT_KEY_INSERT             260
-#define PT_KEY_DELETE             261
-#define PT_KEY_RIGHT              262
-#define PT_KEY_LEFT               263
-#define PT_KEY_DOWN               264
-#define PT_KEY_UP                 265
-#define PT_KEY_PAGE_UP            266
-#define PT_KEY_PAGE_DOWN          267
-#define PT_KEY_HOME               268
-#define PT_KEY_END                269
-#define PT_KEY_CAPS_LOCK          280
-#define PT_KEY_SCROLL_LOCK        281
-#define PT_KEY_NUM_LOCK           282
-#define PT_KEY_PRINT_SCREEN       283
-#define PT_KEY_PAUSE              284
-#define PT_KEY_F1                 290
-#define PT_KEY_F2                 291
-#define PT_KEY_F3                 292
-#define PT_KEY_F4                 293
-#define PT_KEY_F5                 294
-#define PT_KEY_F6                 295
-#define PT_KEY_F7                 296
-#define PT_KEY_F8                 297
-#define PT_KEY_F9                 298
-#define PT_KEY_F10                299
-#define PT_KEY_F11                300
-#define PT_KEY_F12                301
-#define PT_KEY_F13                302
-#define PT_KEY_F14                303
-#define PT_KEY_F15                304
-#define PT_KEY_F16                305
-#define PT_KEY_F17                306
-#define PT_KEY_F18                307
-#define PT_KEY_F19                308
-#define PT_KEY_F20                309
-#define PT_KEY_F21                310
-#define PT_KEY_F22                311
-#define PT_KEY_F23                312
-#define PT_KEY_F24                313
-#define PT_KEY_F25                314
-#define PT_KEY_KP_0               320
-#define PT_KEY_KP_1               321
-#define PT_KEY_KP_2               322
-#define PT_KEY_KP_3               323
-#define PT_KEY_KP_4               324
-#define PT_KEY_KP_5               325
-#define PT_KEY_KP_6               326
-#define PT_KEY_KP_7               327
-#define PT_KEY_KP_8               328
-#define PT_KEY_KP_9               329
-#define PT_KEY_KP_DECIMAL         330
-#define PT_KEY_KP_DIVIDE          331
-#define PT_KEY_KP_MULTIPLY        332
-#define PT_KEY_KP_SUBTRACT        333
-#define PT_KEY_KP_ADD             334
-#define PT_KEY_KP_ENTER           335
-#define PT_KEY_KP_EQUAL           336
-#define PT_KEY_LEFT_SHIFT         340
-#define PT_KEY_LEFT_CONTROL       341
-#define PT_KEY_LEFT_ALT           342
-#define PT_KEY_LEFT_SUPER         343
-#define PT_KEY_RIGHT_SHIFT        344
-#define PT_KEY_RIGHT_CONTROL      345
-#define PT_KEY_RIGHT_ALT          346
-#define PT_KEY_RIGHT_SUPER        347
-#define PT_KEY_MENU               348
-
-#define PT_KEY_LAST               PT_KEY_MENU
-
-#define PT_MOUSE_BUTTON_1         0
-#define PT_MOUSE_BUTTON_2         1
-#define PT_MOUSE_BUTTON_3         2
-#define PT_MOUSE_BUTTON_4         3
-#define PT_MOUSE_BUTTON_5         4
-#define PT_MOUSE_BUTTON_6         5
-#define PT_MOUSE_BUTTON_7         6
-#define PT_MOUSE_BUTTON_8         7
-#define PT_MOUSE_BUTTON_LAST      PT_MOUSE_BUTTON_8
-#define PT_MOUSE_BUTTON_LEFT      PT_MOUSE_BUTTON_1
-#define PT_MOUSE_BUTTON_RIGHT     PT_MOUSE_BUTTON_2
-#define PT_MOUSE_BUTTON_MIDDLE    PT_MOUSE_BUTTON_3
+﻿#pragma once
+typedef int KeyCode;
+#define PT_KEY_UNKNOWN            -1
+
+//ripped straight from glfw
+#define PT_KEY_SPACE              32
+#define PT_KEY_APOSTROPHE         39  /* ' */
+#define PT_KEY_COMMA              44  /* , */
+#define PT_KEY_MINUS              45  /* - */
+#define PT_KEY_PERIOD             46  /* . */
+#define PT_KEY_SLASH              47  /* / */
+#define PT_KEY_0                  48
+#define PT_KEY_1                  49
+#define PT_KEY_2                  50
+#define PT_KEY_3                  51
+#define PT_KEY_4                  52
+#define PT_KEY_5                  53
+#define PT_KEY_6                  54
+#define PT_KEY_7                  55
+#define PT_KEY_8                  56
+#define PT_KEY_9                  57
+#define PT_KEY_SEMICOLON          59  /* ; */
+#define PT_KEY_EQUAL              61  /* = */
+#define PT_KEY_A                  65
+#define PT_KEY_B                  66
+#define PT_KEY_C                  67
+#define PT_KEY_D                  68
+#define PT_KEY_E                  69
+#define PT_KEY_F                  70
+#define PT_KEY_G                  71
+#define PT_KEY_H                  72
+#define PT_KEY_I                  73
+#define PT_KEY_J                  74
+#define PT_KEY_K                  75
+#define PT_KEY_L                  76
+#define PT_KEY_M                  77
+#define PT_KEY_N                  78
+#define PT_KEY_O                  79
+#define PT_KEY_P                  80
+#define PT_KEY_Q                  81
+#define PT_KEY_R                  82
+#define PT_KEY_S                  83
+#define PT_KEY_T                  84
+#define PT_KEY_U                  85
+#define PT_KEY_V                  86
+#define PT_KEY_W                  87
+#define PT_KEY_X                  88
+#define PT_KEY_Y                  89
+#define PT_KEY_Z                  90
+#define PT_KEY_LEFT_BRACKET       91  /* [ */
+#define PT_KEY_BACKSLASH          92  /* \ */
+#define PT_KEY_RIGHT_BRACKET      93  /* ] */
+#define PT_KEY_GRAVE_ACCENT       96  /* ` */
+#define PT_KEY_WORLD_1            161 /* non-US #1 */
+#define PT_KEY_WORLD_2            162 /* non-US #2 */
+
+/* Function keys */
+#define PT_KEY_ESCAPE             256
+#define PT_KEY_ENTER              257
+#define PT_KEY_TAB                258
+#define PT_KEY_BACKSPACE          259
+#define PT_KEY_INSERT             260
+#define PT_KEY_DELETE             261
+#define PT_KEY_RIGHT              262
+#define PT_KEY_LEFT               263
+#define PT_KEY_DOWN               264
+#define PT_KEY_UP                 265
+#define PT_KEY_PAGE_UP            266
+#define PT_KEY_PAGE_DOWN          267
+#define PT_KEY_HOME               268
+#define PT_KEY_END                269
+#define PT_KEY_CAPS_LOCK          280
+#define PT_KEY_SCROLL_LOCK        281
+#define PT_KEY_NUM_LOCK           282
+#define PT_KEY_PRINT_SCREEN       283
+#define PT_KEY_PAUSE              284
+#define PT_KEY_F1                 290
+#define PT_KEY_F2                 291
+#define PT_KEY_F3                 292
+#define PT_KEY_F4                 293
+#define PT_KEY_F5                 294
+#define PT_KEY_F6                 295
+#define PT_KEY_F7                 296
+#define PT_KEY_F8                 297
+#define PT_KEY_F9                 298
+#define PT_KEY_F10                299
+#define PT_KEY_F11                300
+#define PT_KEY_F12                301
+#define PT_KEY_F13                302
+#define PT_KEY_F14                303
+#define PT_KEY_F15                304
+#define PT_KEY_F16                305
+#define PT_KEY_F17                306
+#define PT_KEY_F18                307
+#define PT_KEY_F19                308
+#define PT_KEY_F20                309
+#define PT_KEY_F21                310
+#define PT_KEY_F22                311
+#define PT_KEY_F23                312
+#define PT_KEY_F24                313
+#define PT_KEY_F25                314
+#define PT_KEY_KP_0               320
+#define PT_KEY_KP_1               321
+#define PT_KEY_KP_2               322
+#define PT_KEY_KP_3               323
+#define PT_KEY_KP_4               324
+#define PT_KEY_KP_5               325
+#define PT_KEY_KP_6               326
+#define PT_KEY_KP_7               327
+#define PT_KEY_KP_8               328
+#define PT_KEY_KP_9               329
+#define PT_KEY_KP_DECIMAL         330
+#define PT_KEY_KP_DIVIDE          331
+#define PT_KEY_KP_MULTIPLY        332
+#define PT_KEY_KP_SUBTRACT        333
+#define PT_KEY_KP_ADD             334
+#define PT_KEY_KP_ENTER           335
+#define PT_KEY_KP_EQUAL           336
+#define PT_KEY_LEFT_SHIFT         340
+#define PT_KEY_LEFT_CONTROL       341
+#define PT_KEY_LEFT_ALT           342
+#define PT_KEY_LEFT_SUPER         343
+#define PT_KEY_RIGHT_SHIFT        344
+#define PT_KEY_RIGHT_CONTROL      345
+#define PT_KEY_RIGHT_ALT          346
+#define PT_KEY_RIGHT_SUPER        347
+#define PT_KEY_MENU               348
+
+#define PT_KEY_LAST               PT_KEY_MENU
+
+#define PT_MOUSE_BUTTON_1         0
+#define PT_MOUSE_BUTTON_2         1
+#define PT_MOUSE_BUTTON_3         2
+#define PT_MOUSE_BUTTON_4         3
+#define PT_MOUSE_BUTTON_5         4
+#define PT_MOUSE_BUTTON_6         5
+#define PT_MOUSE_BUTTON_7         6
+#define PT_MOUSE_BUTTON_8         7
+#define PT_MOUSE_BUTTON_LAST      PT_MOUSE_BUTTON_8
+#define PT_MOUSE_BUTTON_LEFT      PT_MOUSE_BUTTON_1
+#define PT_MOUSE_BUTTON_RIGHT     PT_MOUSE_BUTTON_2
+#define PT_MOUSE_BUTTON_MIDDLE    PT_MOUSE_BUTTON_3
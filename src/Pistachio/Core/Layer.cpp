@@ -1,12 +1,12 @@
-#include "ptpch.h"
-#include "Layer.h"
-
-namespace Pistachio {
-	Layer::Layer(const char* name) : m_DebugName(name)
-	{
-	}
-	
-	Layer::~Layer()
-	{
-	}
+#include "ptpch.h"
+#include "Layer.h"
+
+namespace Pistachio {
+	Layer::Layer(const char* name) : m_DebugName(name)
+	{
+	}
+	
+	Layer::~Layer()
+	{
+	}
 }
\ No newline at end of file
@@ -1,42 +1,42 @@
-#include "ptpch.h"
-#include "LayerStack.h"
-
-namespace Pistachio {
-	LayerStack::LayerStack()
-	{
-	}
-
-	LayerStack::~LayerStack()
-	{
-		for (Layer* layer : m_Layers)
-			delete layer;
-	}
-
-	void LayerStack::PushLayer(Layer* layer)
-	{
-		m_Layers.emplace(m_Layers.begin() + m_LayerCount, layer);
-		m_LayerCount++;
-	}
-
-	void LayerStack::PushOverlay(Layer* overlay)
-	{
-		m_Layers.push_back(overlay);
-	}
-
-	void LayerStack::PopLayer(Layer* layer)
-	{
-		auto it = std::find(m_Layers.begin(), m_Layers.end(), layer);
-		if (it != m_Layers.end())
-		{
-			m_Layers.erase(it);
-			m_LayerCount--;
-		}
-	}
-
-	void LayerStack::PopOverlay(Layer* overlay)
-	{
-		auto it = std::find(m_Layers.begin(), m_Layers.end(), overlay);
-		if (it != m_Layers.end())
-			m_Layers.erase(it);
-	}
+#include "ptpch.h"
+#include "LayerStack.h"
+
+namespace Pistachio {
+	LayerStack::LayerStack()
+	{
+	}
+
+	LayerStack::~LayerStack()
+	{
+		for (Layer* layer : m_Layers)
+			delete layer;
+	}
+
+	void LayerStack::PushLayer(Layer* layer)
+	{
+		m_Layers.emplace(m_Layers.begin() + m_LayerCount, layer);
+		m_LayerCount++;
+	}
+
+	void LayerStack::PushOverlay(Layer* overlay)
+	{
+		m_Layers.push_back(overlay);
+	}
+
+	void LayerStack::PopLayer(Layer* layer)
+	{
+		auto it = std::find(m_Layers.begin(), m_Layers.end(), layer);
+		if (it != m_Layers.end())
+		{
+			m_Layers.erase(it);
+			m_LayerCount--;
+		}
+	}
+
+	void LayerStack::PopOverlay(Layer* overlay)
+	{
+		auto it = std::find(m_Layers.begin(), m_Layers.end(), overlay);
+		if (it != m_Layers.end())
+			m_Layers.erase(it);
+	}
 }
\ No newline at end of file
@@ -1,25 +1,25 @@
-#pragma once
-
-#include "Pistachio/Core.h"
-#include "Layer.h"
-
-#include <vector>
-
-namespace Pistachio {
-	class PISTACHIO_API LayerStack
-	{
-	public:
-		LayerStack();
-		~LayerStack();
-
-		void PushLayer(Layer* layer);
-		void PushOverlay(Layer* overlay);
-		void PopLayer(Layer* layer);
-		void PopOverlay(Layer* overlay);
-		std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
-		std::vector<Layer*>::iterator end() { return m_Layers.end(); }
-	private:
-		std::vector<Layer*> m_Layers;
-		int m_LayerCount = 0;
-	};
+#pragma once
+
+#include "Pistachio/Core.h"
+#include "Layer.h"
+
+#include <vector>
+
+namespace Pistachio {
+	class PISTACHIO_API LayerStack
+	{
+	public:
+		LayerStack();
+		~LayerStack();
+
+		void PushLayer(Layer* layer);
+		void PushOverlay(Layer* overlay);
+		void PopLayer(Layer* layer);
+		void PopOverlay(Layer* overlay);
+		std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
+		std::vector<Layer*>::iterator end() { return m_Layers.end(); }
+	private:
+		std::vector<Layer*> m_Layers;
+		int m_LayerCount = 0;
+	};
 }
\ No newline at end of file
@@ -1,3 +1,3 @@
-#include "ptpch.h"
-#include "Transform.h"
-#include "Math.h"
+#include "ptpch.h"
+#include "Transform.h"
+#include "Math.h"
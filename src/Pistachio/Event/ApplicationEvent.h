@@ -1,74 +1,74 @@
-#pragma once
-
-#include "Event.h"
-
-namespace Pistachio {
-
-	class WindowResizeEvent : public Event
-	{
-	public:
-		WindowResizeEvent(unsigned int width, unsigned int height)
-			: m_Width(width), m_Height(height) {}
-
-		unsigned int GetWidth() const { return m_Width; }
-		unsigned int GetHeight() const { return m_Height; }
-
-		std::string ToString() const override
-		{
-			return "WindowResizeEvent: " + std::to_string(m_Width) + ", " + std::to_string(m_Height);
-		}
-
-		EVENT_CLASS_TYPE(WindowResize)
-		EVENT_CLASS_CATEGORY(EventCategoryApplication)
-	private:
-		unsigned int m_Width, m_Height;
-	};
-
-	class WindowCloseEvent : public Event
-	{
-	public:
-		WindowCloseEvent() = default;
-
-		EVENT_CLASS_TYPE(WindowClose)
-		EVENT_CLASS_CATEGORY(EventCategoryApplication)
-	};
-
-	class FileDropEvent : public Event
-	{
-	public:
-		FileDropEvent() = default;
-		FileDropEvent(const char* file) : File(file){}
-		EVENT_CLASS_TYPE(AppTick)
-		EVENT_CLASS_CATEGORY(EventCategoryApplication)
-		const std::string& GetFileName() { return File; }
-	private:
-		std::string File;
-	};
-
-	class AppTickEvent : public Event
-	{
-	public:
-		AppTickEvent() = default;
-
-		EVENT_CLASS_TYPE(AppTick)
-		EVENT_CLASS_CATEGORY(EventCategoryApplication)
-	};
-
-	class AppUpdateEvent : public Event
-	{
-	public:
-		AppUpdateEvent() = default;
-
-		EVENT_CLASS_TYPE(AppUpdate)
-		EVENT_CLASS_CATEGORY(EventCategoryApplication)
-	};
-
-	class AppRenderEvent : public Event
-	{
-	public:
-		AppRenderEvent() = default;
-
-		EVENT_CLASS_TYPE(AppRender)
-			EVENT_CLASS_CATEGORY(EventCategoryApplication)
-	};
+#pragma once
+
+#include "Event.h"
+
+namespace Pistachio {
+
+	class WindowResizeEvent : public Event
+	{
+	public:
+		WindowResizeEvent(unsigned int width, unsigned int height)
+			: m_Width(width), m_Height(height) {}
+
+		unsigned int GetWidth() const { return m_Width; }
+		unsigned int GetHeight() const { return m_Height; }
+
+		std::string ToString() const override
+		{
+			return "WindowResizeEvent: " + std::to_string(m_Width) + ", " + std::to_string(m_Height);
+		}
+
+		EVENT_CLASS_TYPE(WindowResize)
+		EVENT_CLASS_CATEGORY(EventCategoryApplication)
+	private:
+		unsigned int m_Width, m_Height;
+	};
+
+	class WindowCloseEvent : public Event
+	{
+	public:
+		WindowCloseEvent() = default;
+
+		EVENT_CLASS_TYPE(WindowClose)
+		EVENT_CLASS_CATEGORY(EventCategoryApplication)
+	};
+
+	class FileDropEvent : public Event
+	{
+	public:
+		FileDropEvent() = default;
+		FileDropEvent(const char* file) : File(file){}
+		EVENT_CLASS_TYPE(AppTick)
+		EVENT_CLASS_CATEGORY(EventCategoryApplication)
+		const std::string& GetFileName() { return File; }
+	private:
+		std::string File;
+	};
+
+	class AppTickEvent : public Event
+	{
+	public:
+		AppTickEvent() = default;
+
+		EVENT_CLASS_TYPE(AppTick)
+		EVENT_CLASS_CATEGORY(EventCategoryApplication)
+	};
+
+	class AppUpdateEvent : public Event
+	{
+	public:
+		AppUpdateEvent() = default;
+
+		EVENT_CLASS_TYPE(AppUpdate)
+		EVENT_CLASS_CATEGORY(EventCategoryApplication)
+	};
+
+	class AppRenderEvent : public Event
+	{
+	public:
+		AppRenderEvent() = default;
+
+		EVENT_CLASS_TYPE(AppRender)
+			EVENT_CLASS_CATEGORY(EventCategoryApplication)
+	};
 }
\ No newline at end of file
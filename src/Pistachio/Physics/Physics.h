@@ -1,11 +1,11 @@
-#pragma once
-#include "../Core/Log.h"
-namespace Pistachio {
-
-	class Physics
-	{
-	public:
-		static void Init();
-		static void Shutdown();
-	};
-}
+#pragma once
+#include "../Core/Log.h"
+namespace Pistachio {
+
+	class Physics
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+	};
+}
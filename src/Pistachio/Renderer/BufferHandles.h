@@ -1,22 +1,42 @@
-#pragma once
-#include <cstdint>
-namespace Pistachio
-{
-	struct RendererVBHandle
-	{
-		//do we need to add size too?
-		uint32_t handle;
-		uint32_t size;
-	};
-	struct RendererIBHandle
-	{
-		uint32_t handle;
-		uint32_t size;
-	};
-	struct RendererCBHandle
-	{
-		uint32_t handle;
-		uint32_t actual_size;
-		uint32_t size;
-	};
-}
+#pragma once
+#include <cstdint>
+namespace Pistachio
+{
+	struct RendererVBHandle
+	{
+		//do we need to add size too?
+		uint32_t handle;
+		uint32_t size;
+	};
+	struct RendererIBHandle
+	{
+		uint32_t handle;
+		uint32_t size;
+	};
+	struct RendererCBHandle
+	{
+		uint32_t handle;
+		uint32_t actual_size;
+		uint32_t size;
+	};
+	//one DrawIndexedIndirect argument record, offsets are in elements of the monolithic index/vertex buffers
+	struct DrawIndexedArgs
+	{
+		uint32_t indexCount;
+		uint32_t instanceCount;
+		uint32_t firstIndex;
+		int32_t vertexOffset;
+		uint32_t firstInstance;
+	};
+	/*
+	* What the indirect buffers hold: the arguments, whose first instance stays 0, and where the draw's instances start.
+	* SV_InstanceID doesn't include the first instance (and a non zero one needs drawIndirectFirstInstance on Vulkan),
+	* so the vertex shaders read instanceBase from this buffer at the call's first record plus the draw index.
+	* The indirect stride skips it.
+	*/
+	struct DrawRecord
+	{
+		DrawIndexedArgs args;
+		uint32_t instanceBase;//into the frame's instance buffer
+	};
+}
@@ -0,0 +1,56 @@
+#include "ptpch.h"
+#include "DepthPyramid.h"
+#include <algorithm>
+
+namespace Pistachio
+{
+	uint32_t DepthPyramid::CountMips(uint32_t width, uint32_t height)
+	{
+		uint32_t size = std::max({ width / 2, height / 2, 1u });
+		uint32_t numMips = 1;
+		while (size > 1) { size /= 2; numMips++; }
+		return numMips;
+	}
+	void DepthPyramid::CreateStack(uint32_t width, uint32_t height PT_DEBUG_REGION(, const char* name))
+	{
+		PT_PROFILE_FUNCTION();
+		m_width = std::max(width / 2, 1u);
+		m_height = std::max(height / 2, 1u);
+		uint32_t numMips = CountMips(width, height);
+		RHI::TextureDesc desc{};
+		desc.depthOrArraySize = 1;
+		desc.height = m_height;
+		desc.width = m_width;
+		desc.mipLevels = numMips;
+		desc.mode = RHI::TextureTilingMode::Optimal;
+		desc.optimizedClearValue = nullptr;
+		desc.format = Format;
+		desc.sampleCount = 1;
+		desc.type = RHI::TextureType::Texture2D;
+		desc.usage = RHI::TextureUsage::SampledImage | RHI::TextureUsage::StorageImage;
+		RHI::AutomaticAllocationInfo allocInfo;
+		allocInfo.access_mode = RHI::AutomaticAllocationCPUAccessMode::None;
+		m_ID = RendererBase::GetDevice()->CreateTexture(desc, nullptr, nullptr, &allocInfo, 0, RHI::ResourceType::Automatic).value();
+		PT_DEBUG_REGION(m_ID->SetName(name));
+		RHI::SubResourceRange range;
+		range.FirstArraySlice = 0;
+		range.imageAspect = RHI::Aspect::COLOR_BIT;
+		range.IndexOrFirstMipLevel = 0;
+		range.NumArraySlices = 1;
+		range.NumMipLevels = numMips;
+
+		RHI::TextureViewDesc viewDesc;
+		viewDesc.format = Format;
+		viewDesc.range = range;
+		viewDesc.texture = m_ID;
+		viewDesc.type = RHI::TextureViewType::Texture2D;
+		m_view = RendererBase::GetDevice()->CreateTextureView(viewDesc).value();
+		m_mipViews.resize(numMips);
+		for (uint32_t mip = 0; mip < numMips; mip++)
+		{
+			viewDesc.range.IndexOrFirstMipLevel = mip;
+			viewDesc.range.NumMipLevels = 1;
+			m_mipViews[mip] = RendererBase::GetDevice()->CreateTextureView(viewDesc).value();
+		}
+	}
+}
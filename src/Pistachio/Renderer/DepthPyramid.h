@@ -0,0 +1,35 @@
+#pragma once
+#include "Pistachio/Renderer/RendererBase.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+namespace Pistachio
+{
+	/*
+	* Hierarchical depth of a depth buffer, every texel keeps the (min, max) depth of the texels it covers.
+	* The first mip is half the depth buffer's size and every following one halves again down to 1x1,
+	* odd sizes fold their last row/column into the last texel so no depth is ever dropped.
+	* The texture is written one mip at a time through storage views and read through a view of the whole chain.
+	*/
+	class PISTACHIO_API DepthPyramid
+	{
+	public:
+		static constexpr RHI::Format Format = RHI::Format::R32G32_FLOAT;
+		//@width and @height are the depth buffer's
+		void CreateStack(uint32_t width, uint32_t height PT_DEBUG_REGION(, const char* name));
+		RHI::Ptr<RHI::Texture> GetID() const { return m_ID; }
+		//every mip, for sampling coarse levels
+		RHI::Ptr<RHI::TextureView> GetView() const { return m_view; }
+		RHI::Ptr<RHI::TextureView> GetMipView(uint32_t mip) const { return m_mipViews[mip]; }
+		uint32_t GetNumMips() const { return (uint32_t)m_mipViews.size(); }
+		uint32_t GetWidth(uint32_t mip = 0) const { return std::max(m_width >> mip, 1u); }
+		uint32_t GetHeight(uint32_t mip = 0) const { return std::max(m_height >> mip, 1u); }
+		//number of mips of a pyramid built from a @width x @height depth buffer
+		static uint32_t CountMips(uint32_t width, uint32_t height);
+	private:
+		RHI::Ptr<RHI::Texture> m_ID;
+		RHI::Ptr<RHI::TextureView> m_view;
+		std::vector<RHI::Ptr<RHI::TextureView>> m_mipViews;
+		uint32_t m_width = 0, m_height = 0;//first mip
+	};
+}
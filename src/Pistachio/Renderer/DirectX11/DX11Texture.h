@@ -1,11 +1,11 @@
-#pragma once
-#include "../../Core/Error.h"
-#include "../../Utils/RendererUtils.h"
-namespace Pistachio {
-	//class DX11Texture
-	//{
-	//public:
-	//	static Error Create(void* data, unsigned int width, unsigned int height, TextureFormat format,ID3D11ShaderResourceView** pSRV);
-	//	static void Bind(ID3D11ShaderResourceView*const* pTextureView, int slot=0, int numTextures=1);
-	//};
-}
+#pragma once
+#include "../../Core/Error.h"
+#include "../../Utils/RendererUtils.h"
+namespace Pistachio {
+	//class DX11Texture
+	//{
+	//public:
+	//	static Error Create(void* data, unsigned int width, unsigned int height, TextureFormat format,ID3D11ShaderResourceView** pSRV);
+	//	static void Bind(ID3D11ShaderResourceView*const* pTextureView, int slot=0, int numTextures=1);
+	//};
+}
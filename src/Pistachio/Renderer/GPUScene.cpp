@@ -0,0 +1,103 @@
+#include "ptpch.h"
+#include "GPUScene.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Pistachio
+{
+	void GPUScene::Initialize(uint32_t initialCapacity)
+	{
+		capacity = std::max(initialCapacity, 1u);
+		CreateFrameBuffers();
+	}
+	void GPUScene::CreateFrameBuffers()
+	{
+		for (auto& frame : frames)
+		{
+			auto err = frame.buffer.CreateStack(nullptr, capacity * ObjectStride, SBCreateFlags::AllowCPUAccess);
+			if (!err.Successful())
+			{
+				PT_CORE_ERROR("Could not create the gpu scene buffer");
+				Error::LogErrorToConsole(err);
+				PT_DEBUG_BREAK;
+			}
+		}
+	}
+	void GPUScene::Grow(uint32_t minCapacity)
+	{
+		PT_PROFILE_FUNCTION();
+		PT_CORE_WARN("Growing GPU Scene");
+		//every frame's buffer is replaced, so the gpu can't be reading any of them
+		RendererBase::Get().mainFence->Wait(RendererBase::Get().currentFenceVal);
+		capacity = std::max(minCapacity, capacity * 2);
+		CreateFrameBuffers();
+		for (uint32_t id = 0; id < objects.size(); id++) Queue(id);
+	}
+	uint32_t GPUScene::Allocate()
+	{
+		if (!freeIDs.empty())
+		{
+			uint32_t id = freeIDs.back();
+			freeIDs.pop_back();
+			return id;
+		}
+		uint32_t id = (uint32_t)objects.size();
+		objects.emplace_back();
+		pendingFrames.push_back(0);
+		if (objects.size() > capacity) Grow((uint32_t)objects.size());
+		return id;
+	}
+	void GPUScene::Free(uint32_t id)
+	{
+		//a queued copy of a freed slot is harmless, the id is only handed out again with new data
+		freeIDs.push_back(id);
+	}
+	void GPUScene::Set(uint32_t id, const TransformData& data)
+	{
+		objects[id].data = data;
+		Queue(id);
+	}
+	void GPUScene::SetBounds(uint32_t id, const BoundingBox& bounds)
+	{
+		objects[id].boundsCenter = { bounds.Center.x, bounds.Center.y, bounds.Center.z, 0.f };
+		objects[id].boundsExtents = { bounds.Extents.x, bounds.Extents.y, bounds.Extents.z, 0.f };
+		Queue(id);
+	}
+	void GPUScene::Queue(uint32_t id)
+	{
+		constexpr uint8_t allFrames = (1u << RendererBase::numFramesInFlight) - 1;
+		uint8_t missing = allFrames & ~pendingFrames[id];
+		if (!missing) return;
+		for (uint32_t i = 0; i < RendererBase::numFramesInFlight; i++)
+			if (missing & (1u << i)) frames[i].pending.push_back(id);
+		pendingFrames[id] = allFrames;
+	}
+	GPUScene::UploadStats GPUScene::Upload(uint32_t frameIndex)
+	{
+		PT_PROFILE_FUNCTION();
+		UploadStats stats;
+		auto& pending = frames[frameIndex].pending;
+		if (pending.empty()) return stats;
+		//sorted ids turn runs of neighbouring slots into one copy
+		std::sort(pending.begin(), pending.end());
+		uint8_t* dst = static_cast<uint8_t*>(frames[frameIndex].buffer.GetID()->Map().value());
+		const uint8_t* src = reinterpret_cast<const uint8_t*>(objects.data());
+		const uint8_t frameBit = (uint8_t)(1u << frameIndex);
+		for (size_t i = 0; i < pending.size();)
+		{
+			size_t end = i + 1;
+			while (end < pending.size() && pending[end] == pending[end - 1] + 1) end++;
+			uint32_t first = pending[i];
+			uint32_t count = (uint32_t)(end - i);
+			memcpy(dst + (size_t)first * ObjectStride, src + (size_t)first * ObjectStride, (size_t)count * ObjectStride);
+			for (size_t j = i; j < end; j++) pendingFrames[pending[j]] &= ~frameBit;
+			stats.numCopies++;
+			stats.numBytes += count * ObjectStride;
+			i = end;
+		}
+		frames[frameIndex].buffer.GetID()->UnMap();
+		stats.numObjects = (uint32_t)pending.size();
+		pending.clear();
+		return stats;
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "Pistachio/Core/Math.h"
+#include "Pistachio/Renderer/Buffer.h"
+#include "Pistachio/Renderer/RendererBase.h"
+#include "Pistachio/Renderer/RendererContext.h"
+#include <cstdint>
+#include <vector>
+namespace Pistachio
+{
+	/*
+	* Persistent per-object data of a scene, every object owns a slot for its whole lifetime.
+	* Writes land in a CPU copy and are queued for every frame in flight, each frame then maps its own
+	* buffer once and copies the queued slots, merging neighbouring slots into a single memcpy.
+	* Shaders read the slots as a structured buffer with a 256 byte element, indexed by the object id of the instance being drawn.
+	*/
+	class PISTACHIO_API GPUScene
+	{
+	public:
+		static constexpr uint32_t InvalidID = UINT32_MAX;
+		static constexpr uint32_t ObjectStride = 256;
+		struct UploadStats
+		{
+			uint32_t numObjects = 0;
+			uint32_t numCopies = 0;//memcpy calls, neighbouring slots share one
+			uint32_t numBytes = 0;
+		};
+		void Initialize(uint32_t initialCapacity);
+		uint32_t Allocate();
+		void Free(uint32_t id);
+		void Set(uint32_t id, const TransformData& data);
+		//world space box of the object, read by the gpu culling pass
+		void SetBounds(uint32_t id, const BoundingBox& bounds);
+		//copies everything queued for @frameIndex into that frame's buffer, call once per frame before any draw reads it
+		UploadStats Upload(uint32_t frameIndex);
+		RHI::Ptr<RHI::Buffer> GetBuffer(uint32_t frameIndex) const { return frames[frameIndex].buffer.GetID(); }
+		//bytes, changes when the buffers are recreated so bindings to them have to be updated
+		uint32_t GetBufferSize() const { return capacity * ObjectStride; }
+		uint32_t GetCapacity() const { return capacity; }
+		uint32_t GetNumObjects() const { return (uint32_t)(objects.size() - freeIDs.size()); }
+	private:
+		struct alignas(16) Slot
+		{
+			TransformData data;
+			DirectX::XMFLOAT4 boundsCenter;
+			DirectX::XMFLOAT4 boundsExtents;
+			uint8_t padding[ObjectStride - sizeof(TransformData) - sizeof(DirectX::XMFLOAT4) * 2];
+		};
+		static_assert(sizeof(Slot) == ObjectStride);
+		struct Frame
+		{
+			StructuredBuffer buffer;
+			std::vector<uint32_t> pending;
+		};
+		void CreateFrameBuffers();
+		void Grow(uint32_t minCapacity);
+		void Queue(uint32_t id);
+	private:
+		Frame frames[RendererBase::numFramesInFlight];
+		std::vector<Slot> objects;//cpu copy, indexed by id
+		std::vector<uint8_t> pendingFrames;//bit i is set while the id is queued for frame i
+		std::vector<uint32_t> freeIDs;
+		uint32_t capacity = 0;
+	};
+}
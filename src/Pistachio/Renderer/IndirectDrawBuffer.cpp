@@ -0,0 +1,37 @@
+#include "ptpch.h"
+#include "IndirectDrawBuffer.h"
+#include <algorithm>
+#include <cstring>
+
+static const uint32_t INITIAL_DRAW_CAPACITY = 1024;
+namespace Pistachio
+{
+	void IndirectDrawBuffer::Upload(uint32_t frameIndex)
+	{
+		PT_PROFILE_FUNCTION();
+		Frame& frame = frames[frameIndex];
+		if (args.size() > frame.capacity)
+		{
+			//only this frame's buffer is replaced, the gpu is done with it
+			frame.capacity = std::max({ (uint32_t)args.size(), frame.capacity * 2, INITIAL_DRAW_CAPACITY });
+			RHI::BufferDesc bufferDesc{
+				.size = frame.capacity * Stride,
+				.usage = RHI::BufferUsage::IndirectBuffer | RHI::BufferUsage::StructuredBuffer//also read by the gpu culling pass
+			};
+			RHI::AutomaticAllocationInfo info{};
+			info.access_mode = RHI::AutomaticAllocationCPUAccessMode::Sequential;
+			auto res = RendererBase::GetDevice()->CreateBuffer(bufferDesc, nullptr, nullptr, &info, 0, RHI::ResourceType::Automatic);
+			if (res.is_err())
+			{
+				PT_CORE_ERROR("Could not create the indirect draw buffer");
+				frame.capacity = 0;
+				return;
+			}
+			frame.buffer = std::move(res).value();
+		}
+		if (args.empty()) return;
+		void* dst = frame.buffer->Map().value();
+		memcpy(dst, args.data(), args.size() * Stride);
+		frame.buffer->UnMap();
+	}
+}
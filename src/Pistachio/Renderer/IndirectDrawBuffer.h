@@ -0,0 +1,37 @@
+#pragma once
+#include "Pistachio/Renderer/BufferHandles.h"
+#include "Pistachio/Renderer/RendererBase.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+namespace Pistachio
+{
+	/*
+	* DrawIndexedIndirect records of a frame, filled on the CPU and copied with a single map.
+	* Every frame in flight owns its buffer, which grows when a frame records more draws than it holds.
+	* The vertex shaders bind the buffer too and read every record's instance base from it.
+	*/
+	class PISTACHIO_API IndirectDrawBuffer
+	{
+	public:
+		static constexpr uint32_t Stride = sizeof(DrawRecord);
+		void Clear() { args.clear(); }
+		void Push(const DrawIndexedArgs& draw, uint32_t instanceBase) { args.push_back({ draw, instanceBase }); }
+		//copies every record into @frameIndex's buffer, call once per frame before any pass reads it
+		void Upload(uint32_t frameIndex);
+		RHI::Ptr<RHI::Buffer> GetBuffer(uint32_t frameIndex) const { return frames[frameIndex].buffer; }
+		static uint32_t GetOffset(uint32_t index) { return index * Stride; }
+		//bytes, changes when @frameIndex's buffer is recreated so bindings to it have to be updated
+		uint32_t GetBufferSize(uint32_t frameIndex) const { return frames[frameIndex].capacity * Stride; }
+		std::span<const DrawRecord> GetRecords() const { return args; }
+		uint32_t Size() const { return (uint32_t)args.size(); }
+	private:
+		struct Frame
+		{
+			RHI::Ptr<RHI::Buffer> buffer;
+			uint32_t capacity = 0;
+		};
+		Frame frames[RendererBase::numFramesInFlight];
+		std::vector<DrawRecord> args;
+	};
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "Pistachio/Renderer/Renderer.h"
+#include <cstdint>
+#include <cstring>
+#include <span>
+namespace Pistachio
+{
+	/*
+	* Layout of the light list the cluster culling, shadow and forward shaders read: the regular lights, then the shadow
+	* casting ones, each in the order the scene gathered them. Write puts both lists at their final offsets, so a mapped
+	* buffer is filled with one copy per list and nothing is joined on the CPU first.
+	*/
+	class PISTACHIO_API LightListLayout
+	{
+	public:
+		//the shaders step through the list in float4s, see RegularLightStepSize and ShadowLightStepSize in CFCullLights_cs
+		static constexpr uint32_t RegularStride = 64;
+		static constexpr uint32_t ShadowStride = 336;
+		static_assert(sizeof(Light) == RegularStride);
+		static_assert(sizeof(ShadowCastingLight) == ShadowStride);
+		static constexpr uint32_t GetSize(uint32_t numRegular, uint32_t numShadow) { return RegularStride * numRegular + ShadowStride * numShadow; }
+		static constexpr uint32_t GetShadowOffset(uint32_t numRegular) { return RegularStride * numRegular; }
+		//@dst holds at least GetSize bytes, returns the bytes written
+		static uint32_t Write(void* dst, std::span<const Light> regular, std::span<const ShadowCastingLight> shadow)
+		{
+			uint8_t* bytes = static_cast<uint8_t*>(dst);
+			if (!regular.empty()) memcpy(bytes, regular.data(), regular.size_bytes());
+			if (!shadow.empty()) memcpy(bytes + GetShadowOffset((uint32_t)regular.size()), shadow.data(), shadow.size_bytes());
+			return GetSize((uint32_t)regular.size(), (uint32_t)shadow.size());
+		}
+		//maps @buffer (anything with the Map/UnMap of an RHI buffer) and writes both lists into it, an empty list isn't mapped at all
+		template<typename BufferPtr>
+		static uint32_t Upload(BufferPtr buffer, std::span<const Light> regular, std::span<const ShadowCastingLight> shadow)
+		{
+			if (regular.empty() && shadow.empty()) return 0;
+			void* dst = buffer->Map().value();
+			uint32_t written = Write(dst, regular, shadow);
+			buffer->UnMap();
+			return written;
+		}
+	};
+}
@@ -0,0 +1,57 @@
+#include "ptpch.h"
+#include "RenderQueue.h"
+#include <algorithm>
+
+namespace Pistachio
+{
+	uint32_t RenderQueue::QuantizeDepth(float viewDepth, float nearZ, float farZ)
+	{
+		constexpr uint32_t maxDepth = (1u << DepthBits) - 1;
+		float t = (viewDepth - nearZ) / (farZ - nearZ);
+		t = std::clamp(t, 0.f, 1.f);
+		return (uint32_t)(t * (float)maxDepth);
+	}
+	void RenderQueue::Sort()
+	{
+		PT_PROFILE_FUNCTION();
+		const size_t count = items.size();
+		if (count < 2) return;
+		//one histogram per byte, all built in a single read of the keys
+		uint32_t histograms[8][256] = {};
+		for (const Item& item : items)
+			for (uint32_t b = 0; b < 8; b++) histograms[b][(item.key >> (b * 8)) & 0xff]++;
+		scratch.resize(count);
+		Item* src = items.data();
+		Item* dst = scratch.data();
+		for (uint32_t b = 0; b < 8; b++)
+		{
+			uint32_t* histogram = histograms[b];
+			//every key has the same byte here, the pass wouldn't move anything
+			if (histogram[(src[0].key >> (b * 8)) & 0xff] == count) continue;
+			uint32_t offset = 0;
+			for (uint32_t i = 0; i < 256; i++)
+			{
+				uint32_t n = histogram[i];
+				histogram[i] = offset;
+				offset += n;
+			}
+			for (size_t i = 0; i < count; i++)
+				dst[histogram[(src[i].key >> (b * 8)) & 0xff]++] = src[i];
+			std::swap(src, dst);
+		}
+		if (src != items.data()) items.swap(scratch);
+	}
+	void RenderQueue::BuildBatches()
+	{
+		PT_PROFILE_FUNCTION();
+		batches.clear();
+		for (uint32_t i = 0; i < items.size();)
+		{
+			uint32_t end = i + 1;
+			if (items[i].batch != NoBatch)
+				while (end < items.size() && items[end].batch == items[i].batch) end++;
+			batches.push_back({ i, end - i });
+			i = end;
+		}
+	}
+}
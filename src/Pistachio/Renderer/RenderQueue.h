@@ -0,0 +1,88 @@
+#pragma once
+#include "Pistachio/Core.h"
+#include "entt.hpp"
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+namespace Pistachio
+{
+	/*
+	* List of draws ordered by a 64 bit sort key, rebuilt every frame.
+	* Keys are radix sorted 8 bits at a time, bytes that are the same for every key are skipped,
+	* so a queue whose keys only differ in a few fields costs a couple of linear passes.
+	* Fields wider than their slot wrap, which only weakens the grouping, never the correctness of a draw.
+	* Every item also carries an exact batch key, neighbours that share one after sorting become a single instanced draw.
+	*/
+	class PISTACHIO_API RenderQueue
+	{
+	public:
+		struct Item
+		{
+			uint64_t key;
+			uint64_t batch;
+			entt::entity entity;
+		};
+		//run of items [first, first + count) drawn as instances of the first one
+		struct Batch
+		{
+			uint32_t first;
+			uint32_t count;
+		};
+		enum class Pass : uint32_t { ZPrepass, Opaque, Shadow };
+		static constexpr uint64_t NoBatch = UINT64_MAX;
+		static constexpr uint32_t DepthBits = 16;
+		/*
+		* State sorted key, used by passes that switch pipelines and materials:
+		* pass(4) | shader(12) | material(16) | mesh(16) | depth(16), draws with the same state are front to back
+		*/
+		static uint64_t StateKey(Pass pass, uint32_t shader, uint32_t material, uint32_t mesh, uint32_t depth)
+		{
+			return ((uint64_t)pass << 60) | ((uint64_t)(shader & 0xfff) << 48) | ((uint64_t)(material & 0xffff) << 32) |
+				((uint64_t)(mesh & 0xffff) << 16) | (depth & 0xffff);
+		}
+		//mesh first key for passes with a single pipeline: pass(4) | mesh(16) | depth(16), instances of a mesh are front to back
+		static uint64_t MeshKey(Pass pass, uint32_t mesh, uint32_t depth)
+		{
+			return ((uint64_t)pass << 60) | ((uint64_t)(mesh & 0xffff) << 16) | (depth & 0xffff);
+		}
+		//key for draws split in several lists (one per shadow projection): pass(4) | list(16) | mesh(16)
+		static uint64_t ListKey(Pass pass, uint32_t list, uint32_t mesh)
+		{
+			return ((uint64_t)pass << 60) | ((uint64_t)(list & 0xffff) << 16) | (mesh & 0xffff);
+		}
+		//list key with a low field that orders the items of a batch: pass(4) | list(16) | mesh(16) | sub(16)
+		static uint64_t ListSubKey(Pass pass, uint32_t list, uint32_t mesh, uint32_t sub)
+		{
+			return ((uint64_t)pass << 60) | ((uint64_t)(list & 0xffff) << 32) | ((uint64_t)(mesh & 0xffff) << 16) | (sub & 0xffff);
+		}
+		//maps a view space depth between @nearZ and @farZ to DepthBits bits, nearer is smaller
+		static uint32_t QuantizeDepth(float viewDepth, float nearZ, float farZ);
+		void Clear() { items.clear(); batches.clear(); }
+		//@batch has to identify the mesh (and whatever else the pass binds per draw) exactly, NoBatch never merges
+		void Push(uint64_t key, entt::entity entity, uint64_t batch = NoBatch) { items.push_back({ key, batch, entity }); }
+		void Sort();
+		//merges neighbouring items with the same batch key, call after Sort
+		void BuildBatches();
+		std::span<const Item> GetItems() const { return items; }
+		std::span<const Batch> GetBatches() const { return batches; }
+		uint32_t Size() const { return (uint32_t)items.size(); }
+	private:
+		std::vector<Item> items;
+		std::vector<Item> scratch;
+		std::vector<Batch> batches;
+	};
+	//hands out small dense ids for 64 bit asset uuids, so they fit in a sort key field
+	class PISTACHIO_API SortKeyIDs
+	{
+	public:
+		uint32_t Get(uint64_t uuid)
+		{
+			auto [it, inserted] = ids.try_emplace(uuid, (uint32_t)ids.size());
+			return it->second;
+		}
+		void Clear() { ids.clear(); }
+	private:
+		std::unordered_map<uint64_t, uint32_t> ids;
+	};
+}
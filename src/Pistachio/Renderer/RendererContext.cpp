@@ -202,6 +202,12 @@ namespace Pistachio
 		computeShaders["Tighten Clusters"] = std::unique_ptr<ComputeShader>{ComputeShader::Create({ shader_dir + "CFTightenList_cs.rbc"}, RHI::ShaderMode::File)};
 		PT_CORE_INFO("Cull Lights");
 		computeShaders["Cull Lights"] = std::unique_ptr<ComputeShader>{ComputeShader::Create({ shader_dir+ "CFCullLights_cs.rbc"}, RHI::ShaderMode::File)};
+		PT_CORE_INFO("GPU Culling");
+		computeShaders["GPU Culling"] = std::unique_ptr<ComputeShader>{ComputeShader::Create({ shader_dir + "GPUCull_cs.rbc"}, RHI::ShaderMode::File)};
+		PT_CORE_INFO("HiZ First Mip");
+		computeShaders["HiZ First Mip"] = std::unique_ptr<ComputeShader>{ComputeShader::Create({ shader_dir + "HiZFirstMip_cs.rbc"}, RHI::ShaderMode::File)};
+		PT_CORE_INFO("HiZ Downsample");
+		computeShaders["HiZ Downsample"] = std::unique_ptr<ComputeShader>{ComputeShader::Create({ shader_dir + "HiZDownsample_cs.rbc"}, RHI::ShaderMode::File)};
 		
 		
 
@@ -218,7 +224,8 @@ namespace Pistachio
 		ShaderDesc.numInputs = Mesh::GetLayoutSize();
 		PT_CORE_INFO("Creating Default Forward Shader");
 		auto fwdShader = new ShaderAsset();
-		fwdShader->GetShader().CreateStack(ShaderDesc, {{0,4}}, std::nullopt);
+		//per object data comes from structured buffers in set 0, the push block holds where the pass's instances start
+		fwdShader->GetShader().CreateStack(ShaderDesc, {{4u}}, 1);
 		fwdShader->paramBufferSize = 12;
 		fwdShader->parametersMap["Diffuse"] = ParamInfo{ 0,ParamType::Float };
 		fwdShader->parametersMap["Metallic"] = ParamInfo{ 4,ParamType::Float };
@@ -240,14 +247,21 @@ namespace Pistachio
 		ShaderDesc.InputDescription = Mesh::GetLayout();
 		ShaderDesc.numInputs = Mesh::GetLayoutSize();
 		PT_CORE_INFO("Creating Z-Prepass Shader");
-		shaders["Z-Prepass"] = std::unique_ptr<Shader>{Shader::Create(ShaderDesc, {{0u}}, std::nullopt)};
+		shaders["Z-Prepass"] = std::unique_ptr<Shader>{Shader::Create(ShaderDesc, {}, 1)};
 
 		//shadow shaders
 		vs = shader_dir + "Shadow_vs.rbc";
 		ShaderDesc.VS = RHI::ShaderCode{ vs };
 		ShaderDesc.RasterizerModes->cullMode = RHI::CullMode::Front;
+		//casters in front of a cascade's near plane are flattened onto it rather than clipped
+		ShaderDesc.RasterizerModes->depthClipEnable = false;
 		PT_CORE_INFO("Creating Shadow Shader");
-		shaders["Shadow Shader"] = std::unique_ptr<Shader>{Shader::Create(ShaderDesc, {{0u}}, 1)};
+		shaders["Shadow Shader"] = std::unique_ptr<Shader>{Shader::Create(ShaderDesc, {}, 1)};
+		//every caster drawn once, instanced to the cascades it touches
+		vs = shader_dir + "ShadowCascades_vs.rbc";
+		ShaderDesc.VS = RHI::ShaderCode{ vs };
+		PT_CORE_INFO("Creating Cascaded Shadow Shader");
+		shaders["Cascaded Shadow Shader"] = std::unique_ptr<Shader>{Shader::Create(ShaderDesc, {}, 1)};
 
 
 		BrdfTex.CreateStack(512, 512, RHI::Format::R16G16_FLOAT, nullptr PT_DEBUG_REGION(,"Renderer -> White Texture"),TextureFlags::Compute);
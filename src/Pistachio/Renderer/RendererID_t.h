@@ -1,8 +1,8 @@
-#pragma once
-#include "Pistachio/Core.h"
-#include <type_traits>
-namespace Pistachio
-{
-	typedef PISTACHIO_API union {  void* ptr; std::uintptr_t val;} RendererID_t;
-
-}
+#pragma once
+#include "Pistachio/Core.h"
+#include <type_traits>
+namespace Pistachio
+{
+	typedef PISTACHIO_API union {  void* ptr; std::uintptr_t val;} RendererID_t;
+
+}
@@ -1,41 +1,64 @@
-//Dispatch thread ID corresponds to each pixel
-struct inputStruct
-{
-    float4x4 View;
-    float4x4 InvView;
-    float4x4 Proj;
-    float4x4 InvProj;
-    float4x4 ViewProj;
-    float4x4 InvViewProj;
-    float2 screenSize;
-    float2 InvScreenSize;
-    float zNear;
-    float zFar;
-    float TotalTime;
-    float DeltaTime;
-    float3 EyePosW;
-    float scale;
-    float3 numClusters;
-    float bias;
-};
-ConstantBuffer<inputStruct> inputBuffer : register(b0, space1);
-Texture2D<float> zprepass : register(t0, space0);
-RWStructuredBuffer<uint> clusterActive : register(u1, space0); //these are actually bools
-
-uint getSlice(float z)
-{
-    return (log10(z) * inputBuffer.scale) - inputBuffer.bias;
-}
-
-[numthreads(1, 1, 1)]
-void main( uint3 DTid : SV_DispatchThreadID )
-{
-    float z = zprepass.Load(DTid); // DTid z is always 0;
-    float4 temp = float4(float2(0,0), z, 1);
-    temp = mul(temp, inputBuffer.InvProj);
-    uint slice = getSlice(temp.z/temp.w);
-    float2 tileSize = float2(inputBuffer.screenSize) / float2(inputBuffer.numClusters.xy);
-    uint3 cluster = uint3((uint2(float2(DTid.xy) / tileSize)), slice);
-    uint index = cluster.x + (cluster.y * inputBuffer.numClusters.x) + (cluster.z * inputBuffer.numClusters.x * inputBuffer.numClusters.y);
-    clusterActive[index] =  1;
+//Dispatch thread ID corresponds to each texel of the depth pyramid's first mip (2x2 pixels)
+struct inputStruct
+{
+    float4x4 View;
+    float4x4 InvView;
+    float4x4 Proj;
+    float4x4 InvProj;
+    float4x4 ViewProj;
+    float4x4 InvViewProj;
+    float2 screenSize;
+    float2 InvScreenSize;
+    float zNear;
+    float zFar;
+    float TotalTime;
+    float DeltaTime;
+    float3 EyePosW;
+    float scale;
+    float3 numClusters;
+    float bias;
+};
+ConstantBuffer<inputStruct> inputBuffer : register(b0, space1);
+Texture2D<float2> depthPyramid : register(t0, space0); //(min, max) depth
+RWStructuredBuffer<uint> clusterActive : register(u1, space0); //these are actually bools
+
+uint getSlice(float z)
+{
+    return (log10(z) * inputBuffer.scale) - inputBuffer.bias;
+}
+float viewDepth(float z)
+{
+    float4 temp = float4(float2(0,0), z, 1);
+    temp = mul(temp, inputBuffer.InvProj);
+    return temp.z/temp.w;
+}
+
+[numthreads(1, 1, 1)]
+void main( uint3 DTid : SV_DispatchThreadID )
+{
+    uint2 mipSize;
+    depthPyramid.GetDimensions(mipSize.x, mipSize.y);
+    float2 z = depthPyramid.Load(int3(DTid.xy, 0));
+    //every slice between the nearest and farthest pixel is marked, a superset of the slices the 2x2 pixels touch
+    uint firstSlice = getSlice(viewDepth(z.x));
+    uint lastSlice = getSlice(viewDepth(z.y));
+    //pixels under the texel, the last texel also covers an odd screen's last row/column
+    uint2 firstPixel = DTid.xy * 2;
+    uint2 lastPixel = min(firstPixel + 1, uint2(inputBuffer.screenSize) - 1);
+    if (DTid.x == mipSize.x - 1) lastPixel.x = uint(inputBuffer.screenSize.x) - 1;
+    if (DTid.y == mipSize.y - 1) lastPixel.y = uint(inputBuffer.screenSize.y) - 1;
+    float2 tileSize = float2(inputBuffer.screenSize) / float2(inputBuffer.numClusters.xy);
+    uint2 firstTile = uint2(float2(firstPixel) / tileSize);
+    uint2 lastTile = uint2(float2(lastPixel) / tileSize);
+    for (uint slice = firstSlice; slice <= lastSlice; slice++)
+    {
+        for (uint y = firstTile.y; y <= lastTile.y; y++)
+        {
+            for (uint x = firstTile.x; x <= lastTile.x; x++)
+            {
+                uint index = x + (y * inputBuffer.numClusters.x) + (slice * inputBuffer.numClusters.x * inputBuffer.numClusters.y);
+                clusterActive[index] =  1;
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,152 @@
+//tests/gpu_cull_test.cpp has a CPU copy of this shader, change both
+
+struct inputStruct
+{
+    float4x4 View;
+    float4x4 InvView;
+    float4x4 Proj;
+    float4x4 InvProj;
+    float4x4 ViewProj;
+    float4x4 InvViewProj;
+    float2 screenSize;
+    float2 InvScreenSize;
+    float zNear;
+    float zFar;
+    float TotalTime;
+    float DeltaTime;
+    float3 EyePosW;
+    float scale;
+    float3 csDimensions;
+    float bias;
+};
+struct ObjectData
+{
+    matrix transform;
+    matrix normalmatrix;
+    float4 boundsCenter;
+    float4 boundsExtents;
+    float4 padding[6];//gpu scene slots are 256 bytes
+};
+struct DrawIndexedArgs
+{
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;//always 0
+};
+struct DrawRecord
+{
+    DrawIndexedArgs args;
+    uint instanceBase;//where the record's instances start in the instance buffer, the vertex shaders read it by draw index
+};
+struct CullInfo
+{
+    uint numRecords;
+    uint occlusion;//0 until a depth pyramid was built
+    uint2 padding0;
+    float4x4 pyramidViewProj;//the camera of the previous frame, which built the pyramid
+    uint2 pyramidSize;//first mip
+    uint pyramidMips;
+    uint padding;
+};
+ConstantBuffer<inputStruct> inputBuffer  : register(b0, space1);
+ConstantBuffer<CullInfo> cullInfo         : register(b0, space0);
+StructuredBuffer<ObjectData> objects      : register(t1, space0);
+StructuredBuffer<uint> candidateObjects   : register(t2, space0);
+StructuredBuffer<DrawRecord> drawTemplates : register(t3, space0);
+RWStructuredBuffer<DrawRecord> culledArgs  : register(u4, space0);
+RWStructuredBuffer<uint> culledObjects    : register(u5, space0);
+Texture2D<float2> depthPyramid            : register(t6, space0); //(min, max) depth of the previous frame
+
+groupshared uint survivors;
+groupshared float4 planes[6];
+
+bool IsVisible(float3 center, float3 extents)
+{
+    //the box is only rejected when it lies fully behind one plane
+    [unroll]
+    for (uint i = 0; i < 6; i++)
+    {
+        float radius = dot(extents, abs(planes[i].xyz));
+        if (dot(center, planes[i].xyz) + planes[i].w < -radius) return false;
+    }
+    return true;
+}
+//true when the box is behind the farthest depth the previous frame had over its screen rectangle
+bool IsOccluded(float3 center, float3 extents)
+{
+    float2 ndcMin = float2(1, 1);
+    float2 ndcMax = float2(-1, -1);
+    float nearest = 1;
+    for (uint i = 0; i < 8; i++)
+    {
+        float3 corner = center + extents * float3((i & 1) ? 1 : -1, (i & 2) ? 1 : -1, (i & 4) ? 1 : -1);
+        float4 clip = mul(float4(corner, 1), cullInfo.pyramidViewProj);
+        //a box crossing the near plane covers too much of the screen to be worth testing
+        if (clip.w <= 0) return false;
+        float3 ndc = clip.xyz / clip.w;
+        ndcMin = min(ndcMin, ndc.xy);
+        ndcMax = max(ndcMax, ndc.xy);
+        nearest = min(nearest, ndc.z);
+    }
+    float2 uvMin = saturate(float2(ndcMin.x, -ndcMax.y) * 0.5 + 0.5);
+    float2 uvMax = saturate(float2(ndcMax.x, -ndcMin.y) * 0.5 + 0.5);
+    //the mip where the rectangle is at most one texel wide, so it touches at most 2x2 texels
+    float2 size = (uvMax - uvMin) * float2(cullInfo.pyramidSize);
+    uint mip = min((uint)ceil(log2(max(max(size.x, size.y), 1))), cullInfo.pyramidMips - 1);
+    //odd mips fold their last row/column into the last texel, so texels are found by shifting first mip coordinates
+    uint2 firstMin = uint2(uvMin * float2(cullInfo.pyramidSize));
+    uint2 firstMax = uint2(uvMax * float2(cullInfo.pyramidSize));
+    //a rectangle that doesn't straddle a texel edge one mip down still touches 2x2 texels there, with tighter depth
+    if (mip > 0 && all((firstMax >> (mip - 1)) - (firstMin >> (mip - 1)) <= 1)) mip--;
+    uint2 mipSize = max(cullInfo.pyramidSize >> mip, 1);
+    uint2 texMin = min(firstMin >> mip, mipSize - 1);
+    uint2 texMax = min(firstMax >> mip, mipSize - 1);
+    float farthest = 0;
+    for (uint y = texMin.y; y <= texMax.y; y++)
+        for (uint x = texMin.x; x <= texMax.x; x++)
+            farthest = max(farthest, depthPyramid.Load(int3(x, y, mip)).y);
+    return nearest > farthest;
+}
+//one group per draw record, its instances are compacted in place so the record keeps its instance base
+[numthreads(64, 1, 1)]
+void main(uint3 groupID : SV_GroupID, uint threadID : SV_GroupIndex)
+{
+    uint record = groupID.x;
+    if (record >= cullInfo.numRecords) return;
+    DrawRecord draw = drawTemplates[record];
+    if (threadID == 0)
+    {
+        survivors = 0;
+        //clip space planes of the camera, vectors are rows so the planes come from the columns
+        float4x4 m = transpose(inputBuffer.ViewProj);
+        planes[0] = m[3] + m[0];
+        planes[1] = m[3] - m[0];
+        planes[2] = m[3] + m[1];
+        planes[3] = m[3] - m[1];
+        planes[4] = m[2];
+        planes[5] = m[3] - m[2];
+    }
+    GroupMemoryBarrierWithGroupSync();
+    uint base = draw.instanceBase;
+    for (uint i = threadID; i < draw.args.instanceCount; i += 64)
+    {
+        uint object = candidateObjects[base + i];
+        float3 center = objects[object].boundsCenter.xyz;
+        float3 extents = objects[object].boundsExtents.xyz;
+        if (IsVisible(center, extents) && !(cullInfo.occlusion && IsOccluded(center, extents)))
+        {
+            //survivors lose their front to back order inside the batch, batches keep theirs
+            uint slot;
+            InterlockedAdd(survivors, 1, slot);
+            culledObjects[base + slot] = object;
+        }
+    }
+    GroupMemoryBarrierWithGroupSync();
+    if (threadID == 0)
+    {
+        draw.args.instanceCount = survivors;
+        culledArgs[record] = draw;
+    }
+}
@@ -0,0 +1,29 @@
+//tests/gpu_cull_test.cpp has a CPU copy of this shader, change both
+RWTexture2D<float2> src : register(u0, space0);
+RWTexture2D<float2> dst : register(u1, space0);
+
+//every texel reduces the 2x2 texels of the previous mip under it, min of the mins and max of the maxes
+[numthreads(8, 8, 1)]
+void main( uint3 DTid : SV_DispatchThreadID )
+{
+    uint2 dstSize;
+    dst.GetDimensions(dstSize.x, dstSize.y);
+    if (DTid.x >= dstSize.x || DTid.y >= dstSize.y) return;
+    uint2 srcSize;
+    src.GetDimensions(srcSize.x, srcSize.y);
+    //an odd source folds its last row/column into the last texel
+    uint2 first = DTid.xy * 2;
+    uint2 last = min(first + 1, srcSize - 1);
+    if (DTid.x == dstSize.x - 1) last.x = srcSize.x - 1;
+    if (DTid.y == dstSize.y - 1) last.y = srcSize.y - 1;
+    float2 result = float2(1.0, 0.0);
+    for (uint y = first.y; y <= last.y; y++)
+    {
+        for (uint x = first.x; x <= last.x; x++)
+        {
+            float2 z = src[uint2(x, y)];
+            result = float2(min(result.x, z.x), max(result.y, z.y));
+        }
+    }
+    dst[DTid.xy] = result;
+}
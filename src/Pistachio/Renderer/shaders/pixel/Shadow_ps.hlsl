@@ -1,4 +1,4 @@
-float4 main(float3 worldpos: WORLD_POSITION) : SV_TARGET
-{
-	return float4(worldpos.zzz, 1.0f);
+float4 main(float3 worldpos: WORLD_POSITION) : SV_TARGET
+{
+	return float4(worldpos.zzz, 1.0f);
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+struct ObjectData
+{
+    matrix transform;
+    matrix normalmatrix;
+    float4 boundsCenter;
+    float4 boundsExtents;
+    float4 padding[6];//gpu scene slots are 256 bytes
+};
+StructuredBuffer<ObjectData> objects : register(t0, space0);
+//object id of every instance with the cascade it's drawn into in the top 2 bits, one instance per caster and cascade it touches
+StructuredBuffer<uint> instanceObjects : register(t1, space0);
+//indirect record of every draw, DrawIndex counts the draws of one indirect call and the call's first record is pushed
+struct DrawRecord
+{
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+    uint instanceBase;
+};
+StructuredBuffer<DrawRecord> drawRecords : register(t2, space0);
+
+struct lightIndex
+{
+    uint index;
+    uint unused;//the cascade comes from the instance
+    uint firstRecord;
+};
+[[vk::push_constant]] lightIndex index : register(b1);
+
+StructuredBuffer<float4> lights : register(t0, space1);
+static const uint CascadeShift = 30;
+static const uint ObjectMask = (1u << CascadeShift) - 1;
+float4x4 CascadeProjection(uint startIndex, uint cascade)
+{
+    float4x4 projection;
+    projection._11_21_31_41 = lights[startIndex + 4 + (cascade * 4)];
+    projection._12_22_32_42 = lights[startIndex + 5 + (cascade * 4)];
+    projection._13_23_33_43 = lights[startIndex + 6 + (cascade * 4)];
+    projection._14_24_34_44 = lights[startIndex + 7 + (cascade * 4)];
+    return projection;
+}
+struct VSOut
+{
+    float4 pos : SV_POSITION;
+    //the cascade's [-w, w] square, everything outside would land in a neighbouring cascade
+    float4 clip : SV_ClipDistance0;
+};
+/*
+* The viewport covers the light's whole region, the cascades are its quarters (left to right then top to bottom),
+* so the cascade's clip space is squeezed into its quarter here instead of selecting a viewport
+*/
+VSOut main( float4 pos : POSITION, uint instanceID : SV_InstanceID, [[vk::builtin("DrawIndex")]] uint drawIndex : DRAW_INDEX )
+{
+    uint instance = instanceObjects[drawRecords[index.firstRecord + drawIndex].instanceBase + instanceID];
+    uint cascade = instance >> CascadeShift;
+    matrix transform = objects[instance & ObjectMask].transform;
+    float4 clipPos = mul(mul(pos, transform), CascadeProjection(index.index, cascade));
+    VSOut o;
+    o.clip = float4(clipPos.w - clipPos.x, clipPos.w + clipPos.x, clipPos.w - clipPos.y, clipPos.w + clipPos.y);
+    float2 quarter = float2(cascade & 1, cascade >> 1);
+    o.pos = clipPos;
+    o.pos.x = clipPos.x * 0.5 + (quarter.x - 0.5) * clipPos.w;
+    o.pos.y = clipPos.y * 0.5 + (0.5 - quarter.y) * clipPos.w;
+    return o;
+}
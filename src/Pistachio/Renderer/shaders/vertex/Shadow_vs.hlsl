@@ -1,50 +1,69 @@
-cbuffer transform : register(b0, space0)
-{
-    matrix transform;
-    matrix normalmatrix;
-};
-
-struct lightIndex
-{
-    uint index;
-    uint cascade;
-};
-[[vk::push_constant]] lightIndex index : register(b1);
-
-
-
-StructuredBuffer<float4> lights : register(t0, space1);
-//since matrices are colunm major
-struct Light
-{
-    float3 position;
-    int type;
-    float4 colorxintensity;
-    float4 exData;
-    float4 rotation;
-    
-};
-struct ShadowCastingLight
-{
-    Light light;
-    float4x4 projection[4];
-    uint2 shadowMapOffset;
-    uint2 shadowMapSize;
-};
-ShadowCastingLight ShadowLight(uint startIndex, uint cascade)
-{
-    ShadowCastingLight light;
-    //we only need the projection matrix
-    light.projection[0]._11_21_31_41 = lights[startIndex + 4 + (cascade * 4)];
-    light.projection[0]._12_22_32_42 = lights[startIndex + 5 + (cascade * 4)];
-    light.projection[0]._13_23_33_43 = lights[startIndex + 6 + (cascade * 4)];
-    light.projection[0]._14_24_34_44 = lights[startIndex + 7 + (cascade * 4)];
-    light.shadowMapOffset = asint(lights[startIndex + 20].xy);
-    light.shadowMapSize = asint(lights[startIndex + 20].zw);
-    return light;
-}
-float4 main( float4 pos : POSITION ) : SV_POSITION
-{
-    ShadowCastingLight slight = ShadowLight(index.index, index.cascade);
-    return mul(mul(pos, transform), slight.projection[0]);
+struct ObjectData
+{
+    matrix transform;
+    matrix normalmatrix;
+    float4 boundsCenter;
+    float4 boundsExtents;
+    float4 padding[6];//gpu scene slots are 256 bytes
+};
+StructuredBuffer<ObjectData> objects : register(t0, space0);
+//object id of every instance, a draw's instances start at its record's instanceBase, SV_InstanceID counts from 0 in every draw
+StructuredBuffer<uint> instanceObjects : register(t1, space0);
+//indirect record of every draw, DrawIndex counts the draws of one indirect call and the call's first record is pushed
+struct DrawRecord
+{
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+    uint instanceBase;
+};
+StructuredBuffer<DrawRecord> drawRecords : register(t2, space0);
+
+struct lightIndex
+{
+    uint index;
+    uint cascade;
+    uint firstRecord;
+};
+[[vk::push_constant]] lightIndex index : register(b1);
+
+
+
+StructuredBuffer<float4> lights : register(t0, space1);
+//since matrices are colunm major
+struct Light
+{
+    float3 position;
+    int type;
+    float4 colorxintensity;
+    float4 exData;
+    float4 rotation;
+    
+};
+struct ShadowCastingLight
+{
+    Light light;
+    float4x4 projection[4];
+    uint2 shadowMapOffset;
+    uint2 shadowMapSize;
+};
+ShadowCastingLight ShadowLight(uint startIndex, uint cascade)
+{
+    ShadowCastingLight light;
+    //we only need the projection matrix
+    light.projection[0]._11_21_31_41 = lights[startIndex + 4 + (cascade * 4)];
+    light.projection[0]._12_22_32_42 = lights[startIndex + 5 + (cascade * 4)];
+    light.projection[0]._13_23_33_43 = lights[startIndex + 6 + (cascade * 4)];
+    light.projection[0]._14_24_34_44 = lights[startIndex + 7 + (cascade * 4)];
+    light.shadowMapOffset = asint(lights[startIndex + 20].xy);
+    light.shadowMapSize = asint(lights[startIndex + 20].zw);
+    return light;
+}
+float4 main( float4 pos : POSITION, uint instanceID : SV_InstanceID, [[vk::builtin("DrawIndex")]] uint drawIndex : DRAW_INDEX ) : SV_POSITION
+{
+    matrix transform = objects[instanceObjects[drawRecords[index.firstRecord + drawIndex].instanceBase + instanceID]].transform;
+    ShadowCastingLight slight = ShadowLight(index.index, index.cascade);
+    return mul(mul(pos, transform), slight.projection[0]);
 }
\ No newline at end of file
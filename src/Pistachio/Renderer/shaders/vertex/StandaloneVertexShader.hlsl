@@ -1,28 +1,51 @@
-cbuffer CBuf2 : register(b0, space0)
-{
-    matrix transform;
-    matrix normalmatrix;
-};
-cbuffer FrameCB : register(b0,space1)
-{
-    float4x4 View;
-    float4x4 InvView;
-    float4x4 Proj;
-    float4x4 InvProj;
-    float4x4 ViewProj;
-    float4x4 InvViewProj;
-    float4 EyePosW;
-    float2 screenSize;
-    float2 InvScreenSize;
-    float NearZ;
-    float FarZ;
-    float TotalTime;
-    float DeltaTime;
-    float scale;
-    float bias;
-    float3 numClusters;
-}
-float4 main( float4 pos : POSITION ) : SV_Position
-{
-    return mul(mul(pos, transform), ViewProj);
+struct ObjectData
+{
+    matrix transform;
+    matrix normalmatrix;
+    float4 boundsCenter;
+    float4 boundsExtents;
+    float4 padding[6];//gpu scene slots are 256 bytes
+};
+StructuredBuffer<ObjectData> objects : register(t0, space0);
+//object id of every instance, a draw's instances start at its record's instanceBase, SV_InstanceID counts from 0 in every draw
+StructuredBuffer<uint> instanceObjects : register(t1, space0);
+//indirect record of every draw, DrawIndex counts the draws of one indirect call and the call's first record is pushed
+struct DrawRecord
+{
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+    uint instanceBase;
+};
+StructuredBuffer<DrawRecord> drawRecords : register(t2, space0);
+struct InstanceInfo
+{
+    uint firstRecord;
+};
+[[vk::push_constant]] InstanceInfo instance : register(b1);
+cbuffer FrameCB : register(b0,space1)
+{
+    float4x4 View;
+    float4x4 InvView;
+    float4x4 Proj;
+    float4x4 InvProj;
+    float4x4 ViewProj;
+    float4x4 InvViewProj;
+    float4 EyePosW;
+    float2 screenSize;
+    float2 InvScreenSize;
+    float NearZ;
+    float FarZ;
+    float TotalTime;
+    float DeltaTime;
+    float scale;
+    float bias;
+    float3 numClusters;
+}
+float4 main( float4 pos : POSITION, uint instanceID : SV_InstanceID, [[vk::builtin("DrawIndex")]] uint drawIndex : DRAW_INDEX ) : SV_Position
+{
+    matrix transform = objects[instanceObjects[drawRecords[instance.firstRecord + drawIndex].instanceBase + instanceID]].transform;
+    return mul(mul(pos, transform), ViewProj);
 }
\ No newline at end of file
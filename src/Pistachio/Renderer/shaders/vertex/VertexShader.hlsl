@@ -1,44 +1,69 @@
-struct VS_OUT
-{
-    float3 worldpos : WORLD_POSITION;
-	float3 normal : FRAGMENT_NORMAL;
-    float2 UV : UV;
-    float viewSpaceDepth : VS_DEPTH;
-	float4 position : SV_POSITION;
-};
-
-cbuffer FrameCB : register(b0, space1)
-{
-    float4x4 View;
-    float4x4 InvView;
-    float4x4 Proj;
-    float4x4 InvProj;
-    float4x4 ViewProj;
-    float4x4 InvViewProj;
-    float4 EyePosW;
-    float2 RenderTargetSize;
-    float2 InvRenderTargetSize;
-    float NearZ;
-    float FarZ;
-    float TotalTime;
-    float DeltaTime;
-    float4 numlights;
-};
-cbuffer ModelCB : register(b0, space0)
-{
-    matrix transform;
-    matrix normalmatrix;
-};
-
-VS_OUT main(float3 pos : POSITION, float3 normal : NORMAL,float2 UV : UV)
-{
-	VS_OUT vso;
-    vso.worldpos = mul(float4(pos, 1.0f), transform).xyz;
-    vso.UV = UV;
-    vso.normal = normalize(mul(normal, (float3x3) normalmatrix));
-    vso.position = mul(mul(float4(pos, 1.0f), transform), ViewProj);
-    float4 fragPosViewSpace = mul(float4(vso.worldpos, 1.0), View);
-    vso.viewSpaceDepth = abs(fragPosViewSpace.z);
-
-    return vso;
+struct VS_OUT
+{
+    float3 worldpos : WORLD_POSITION;
+	float3 normal : FRAGMENT_NORMAL;
+    float2 UV : UV;
+    float viewSpaceDepth : VS_DEPTH;
+	float4 position : SV_POSITION;
+};
+
+cbuffer FrameCB : register(b0, space1)
+{
+    float4x4 View;
+    float4x4 InvView;
+    float4x4 Proj;
+    float4x4 InvProj;
+    float4x4 ViewProj;
+    float4x4 InvViewProj;
+    float4 EyePosW;
+    float2 RenderTargetSize;
+    float2 InvRenderTargetSize;
+    float NearZ;
+    float FarZ;
+    float TotalTime;
+    float DeltaTime;
+    float4 numlights;
+};
+struct ObjectData
+{
+    matrix transform;
+    matrix normalmatrix;
+    float4 boundsCenter;
+    float4 boundsExtents;
+    float4 padding[6];//gpu scene slots are 256 bytes
+};
+StructuredBuffer<ObjectData> objects : register(t0, space0);
+//object id of every instance, a draw's instances start at its record's instanceBase, SV_InstanceID counts from 0 in every draw
+StructuredBuffer<uint> instanceObjects : register(t1, space0);
+//indirect record of every draw, DrawIndex counts the draws of one indirect call and the call's first record is pushed
+struct DrawRecord
+{
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+    uint instanceBase;
+};
+StructuredBuffer<DrawRecord> drawRecords : register(t2, space0);
+struct InstanceInfo
+{
+    uint firstRecord;
+};
+[[vk::push_constant]] InstanceInfo instance : register(b1);
+
+VS_OUT main(float3 pos : POSITION, float3 normal : NORMAL,float2 UV : UV, uint instanceID : SV_InstanceID, [[vk::builtin("DrawIndex")]] uint drawIndex : DRAW_INDEX)
+{
+	VS_OUT vso;
+    ObjectData object = objects[instanceObjects[drawRecords[instance.firstRecord + drawIndex].instanceBase + instanceID]];
+    matrix transform = object.transform;
+    matrix normalmatrix = object.normalmatrix;
+    vso.worldpos = mul(float4(pos, 1.0f), transform).xyz;
+    vso.UV = UV;
+    vso.normal = normalize(mul(normal, (float3x3) normalmatrix));
+    vso.position = mul(mul(float4(pos, 1.0f), transform), ViewProj);
+    float4 fragPosViewSpace = mul(float4(vso.worldpos, 1.0), View);
+    vso.viewSpaceDepth = abs(fragPosViewSpace.z);
+
+    return vso;
 }
\ No newline at end of file
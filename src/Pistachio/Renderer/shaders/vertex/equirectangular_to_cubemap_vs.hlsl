@@ -1,19 +1,19 @@
-struct VS_OUT
-{
-    float3 localPos : WORLD_POSITION;
-    float4 position : SV_POSITION;
-};
-
-cbuffer CBuf
-{
-    matrix viewProjection;
-    matrix transform;
-};
-
-VS_OUT main( float3 pos : POSITION )
-{
-    VS_OUT vso;
-    vso.localPos = pos.xyz;
-    vso.position = mul(float4(pos, 1.0), viewProjection);
-    return vso;
+struct VS_OUT
+{
+    float3 localPos : WORLD_POSITION;
+    float4 position : SV_POSITION;
+};
+
+cbuffer CBuf
+{
+    matrix viewProjection;
+    matrix transform;
+};
+
+VS_OUT main( float3 pos : POSITION )
+{
+    VS_OUT vso;
+    vso.localPos = pos.xyz;
+    vso.position = mul(float4(pos, 1.0), viewProjection);
+    return vso;
 }
\ No newline at end of file
@@ -0,0 +1,327 @@
+#include "ptpch.h"
+#include "AABBTree.h"
+
+namespace Pistachio
+{
+	static DirectX::XMFLOAT3 Min3(const DirectX::XMFLOAT3& a, const DirectX::XMFLOAT3& b)
+	{
+		return { std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z) };
+	}
+	static DirectX::XMFLOAT3 Max3(const DirectX::XMFLOAT3& a, const DirectX::XMFLOAT3& b)
+	{
+		return { std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z) };
+	}
+	static float SurfaceArea(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max)
+	{
+		float dx = max.x - min.x, dy = max.y - min.y, dz = max.z - min.z;
+		return dx * dy + dy * dz + dz * dx;
+	}
+	static bool Encloses(const AABBTreeNode& node, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max)
+	{
+		return node.min.x <= min.x && node.min.y <= min.y && node.min.z <= min.z &&
+			node.max.x >= max.x && node.max.y >= max.y && node.max.z >= max.z;
+	}
+	static void ToMinMax(const BoundingBox& box, DirectX::XMFLOAT3& min, DirectX::XMFLOAT3& max)
+	{
+		min = { box.Center.x - box.Extents.x, box.Center.y - box.Extents.y, box.Center.z - box.Extents.z };
+		max = { box.Center.x + box.Extents.x, box.Center.y + box.Extents.y, box.Center.z + box.Extents.z };
+	}
+	//fat boxes grow by a tenth of the extents plus a small constant, so slow movers rarely reinsert
+	static void Fatten(const BoundingBox& box, AABBTreeNode& node)
+	{
+		DirectX::XMFLOAT3 margin = { box.Extents.x * 0.1f + 0.05f, box.Extents.y * 0.1f + 0.05f, box.Extents.z * 0.1f + 0.05f };
+		node.min = { node.tightMin.x - margin.x, node.tightMin.y - margin.y, node.tightMin.z - margin.z };
+		node.max = { node.tightMax.x + margin.x, node.tightMax.y + margin.y, node.tightMax.z + margin.z };
+	}
+	uint32_t AABBTree::Insert(const BoundingBox& box, entt::entity entity, uint32_t layer)
+	{
+		uint32_t leaf = AllocateNode();
+		AABBTreeNode& node = nodes[leaf];
+		ToMinMax(box, node.tightMin, node.tightMax);
+		Fatten(box, node);
+		node.entity = entity;
+		node.layers = layer;
+		node.height = 0;
+		InsertLeaf(leaf);
+		numLeaves++;
+		return leaf;
+	}
+	void AABBTree::Remove(uint32_t leaf)
+	{
+		PT_CORE_ASSERT(nodes[leaf].IsLeaf());
+		RemoveLeaf(leaf);
+		FreeNode(leaf);
+		numLeaves--;
+	}
+	bool AABBTree::Move(uint32_t leaf, const BoundingBox& box)
+	{
+		AABBTreeNode& node = nodes[leaf];
+		ToMinMax(box, node.tightMin, node.tightMax);
+		if (Encloses(node, node.tightMin, node.tightMax)) return false;
+		RemoveLeaf(leaf);
+		Fatten(box, nodes[leaf]);
+		InsertLeaf(leaf);
+		return true;
+	}
+	void AABBTree::Clear()
+	{
+		nodes.clear();
+		root = InvalidNode;
+		freeList = InvalidNode;
+		numLeaves = 0;
+	}
+	//squared distance from @p to the box, 0 inside
+	static float DistanceSq(const DirectX::XMFLOAT3& p, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max)
+	{
+		float dx = std::max(std::max(min.x - p.x, 0.f), p.x - max.x);
+		float dy = std::max(std::max(min.y - p.y, 0.f), p.y - max.y);
+		float dz = std::max(std::max(min.z - p.z, 0.f), p.z - max.z);
+		return dx * dx + dy * dy + dz * dz;
+	}
+	entt::entity AABBTree::FindNearest(DirectX::FXMVECTOR point, float maxDistance, uint32_t layerMask, float* distance) const
+	{
+		entt::entity best = entt::null;
+		float bestSq = maxDistance * maxDistance;
+		if (root == InvalidNode) return best;
+		DirectX::XMFLOAT3 p;
+		DirectX::XMStoreFloat3(&p, point);
+		//depth first, nearer child first, and anything further than the best hit so far is skipped
+		uint32_t stack[128];
+		uint32_t top = 0;
+		stack[top++] = root;
+		while (top)
+		{
+			const AABBTreeNode& node = nodes[stack[--top]];
+			if (!(node.layers & layerMask) || DistanceSq(p, node.min, node.max) > bestSq) continue;
+			if (node.IsLeaf())
+			{
+				float d = DistanceSq(p, node.tightMin, node.tightMax);
+				if (d <= bestSq)
+				{
+					bestSq = d;
+					best = node.entity;
+				}
+				continue;
+			}
+			const AABBTreeNode& c1 = nodes[node.child1];
+			const AABBTreeNode& c2 = nodes[node.child2];
+			bool firstNearer = DistanceSq(p, c1.min, c1.max) < DistanceSq(p, c2.min, c2.max);
+			stack[top++] = firstNearer ? node.child2 : node.child1;
+			stack[top++] = firstNearer ? node.child1 : node.child2;
+		}
+		if (distance && best != entt::null) *distance = sqrtf(bestSq);
+		return best;
+	}
+	float AABBTree::RayBox(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& invDirection, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max, float maxDistance)
+	{
+		//slab test, infinities from axis aligned rays fall out of the min/max naturally
+		float t1 = (min.x - origin.x) * invDirection.x, t2 = (max.x - origin.x) * invDirection.x;
+		float tmin = std::min(t1, t2), tmax = std::max(t1, t2);
+		t1 = (min.y - origin.y) * invDirection.y; t2 = (max.y - origin.y) * invDirection.y;
+		tmin = std::max(tmin, std::min(t1, t2)); tmax = std::min(tmax, std::max(t1, t2));
+		t1 = (min.z - origin.z) * invDirection.z; t2 = (max.z - origin.z) * invDirection.z;
+		tmin = std::max(tmin, std::min(t1, t2)); tmax = std::min(tmax, std::max(t1, t2));
+		tmin = std::max(tmin, 0.f);
+		if (tmax < tmin || tmin > maxDistance) return -1.f;
+		return tmin;
+	}
+	void AABBTree::GetPlanes(const BoundingFrustum& frustum, DirectX::XMFLOAT4 planes[6])
+	{
+		DirectX::XMVECTOR p[6];
+		frustum.GetPlanes(&p[0], &p[1], &p[2], &p[3], &p[4], &p[5]);
+		for (uint32_t i = 0; i < 6; i++) DirectX::XMStoreFloat4(&planes[i], p[i]);
+	}
+	void AABBTree::GetPlanes(DirectX::FXMMATRIX viewProj, DirectX::XMFLOAT4 planes[6])
+	{
+		using namespace DirectX;
+		//row vector convention, so the clip space axes are the columns of the matrix
+		XMMATRIX m = XMMatrixTranspose(viewProj);
+		//same order as BoundingFrustum::GetPlanes
+		XMVECTOR p[6] = {
+			XMVectorNegate(m.r[2]),                      //near:    0 <= z
+			XMVectorSubtract(m.r[2], m.r[3]),            //far:     z <= w
+			XMVectorSubtract(m.r[0], m.r[3]),            //right:   x <= w
+			XMVectorNegate(XMVectorAdd(m.r[0], m.r[3])), //left:   -w <= x
+			XMVectorSubtract(m.r[1], m.r[3]),            //top:     y <= w
+			XMVectorNegate(XMVectorAdd(m.r[1], m.r[3])), //bottom: -w <= y
+		};
+		for (uint32_t i = 0; i < 6; i++) XMStoreFloat4(&planes[i], XMPlaneNormalize(p[i]));
+	}
+	AABBTree::PlaneResult AABBTree::TestPlanes(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max, const DirectX::XMFLOAT4* planes, uint32_t& mask)
+	{
+		DirectX::XMFLOAT3 c = { (min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f };
+		DirectX::XMFLOAT3 e = { (max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f };
+		for (uint32_t i = 0, bits = mask; bits; i++, bits >>= 1)
+		{
+			if (!(bits & 1)) continue;
+			const DirectX::XMFLOAT4& p = planes[i];
+			float dist = p.x * c.x + p.y * c.y + p.z * c.z + p.w;
+			float radius = fabsf(p.x) * e.x + fabsf(p.y) * e.y + fabsf(p.z) * e.z;
+			if (dist > radius) return PlaneResult::Outside;
+			if (dist < -radius) mask &= ~(1u << i);
+		}
+		return mask ? PlaneResult::Intersecting : PlaneResult::Inside;
+	}
+	uint32_t AABBTree::AllocateNode()
+	{
+		uint32_t node;
+		if (freeList != InvalidNode)
+		{
+			node = freeList;
+			freeList = nodes[node].parent;
+		}
+		else
+		{
+			node = (uint32_t)nodes.size();
+			nodes.emplace_back();
+		}
+		AABBTreeNode& n = nodes[node];
+		n.parent = n.child1 = n.child2 = InvalidNode;
+		n.height = 0;
+		n.layers = 0;
+		n.entity = entt::null;
+		return node;
+	}
+	void AABBTree::FreeNode(uint32_t node)
+	{
+		nodes[node].parent = freeList;
+		nodes[node].height = -1;
+		freeList = node;
+	}
+	void AABBTree::InsertLeaf(uint32_t leaf)
+	{
+		if (root == InvalidNode)
+		{
+			root = leaf;
+			nodes[root].parent = InvalidNode;
+			return;
+		}
+		//walk down towards the sibling that increases the total surface area the least
+		const DirectX::XMFLOAT3 leafMin = nodes[leaf].min;
+		const DirectX::XMFLOAT3 leafMax = nodes[leaf].max;
+		uint32_t index = root;
+		while (!nodes[index].IsLeaf())
+		{
+			const AABBTreeNode& node = nodes[index];
+			float area = SurfaceArea(node.min, node.max);
+			float combinedArea = SurfaceArea(Min3(node.min, leafMin), Max3(node.max, leafMax));
+			//cost of making a new parent for this node and the leaf
+			float cost = 2.f * combinedArea;
+			//minimum cost of pushing the leaf further down the tree
+			float inheritance = 2.f * (combinedArea - area);
+			auto descendCost = [&](uint32_t child)
+				{
+					const AABBTreeNode& c = nodes[child];
+					float childCombined = SurfaceArea(Min3(c.min, leafMin), Max3(c.max, leafMax));
+					if (c.IsLeaf()) return childCombined + inheritance;
+					return childCombined - SurfaceArea(c.min, c.max) + inheritance;
+				};
+			float cost1 = descendCost(node.child1);
+			float cost2 = descendCost(node.child2);
+			if (cost < cost1 && cost < cost2) break;
+			index = cost1 < cost2 ? node.child1 : node.child2;
+		}
+		uint32_t sibling = index;
+		uint32_t oldParent = nodes[sibling].parent;
+		uint32_t newParent = AllocateNode();
+		AABBTreeNode& parent = nodes[newParent];
+		parent.parent = oldParent;
+		parent.min = Min3(leafMin, nodes[sibling].min);
+		parent.max = Max3(leafMax, nodes[sibling].max);
+		parent.height = nodes[sibling].height + 1;
+		parent.layers = nodes[sibling].layers | nodes[leaf].layers;
+		parent.child1 = sibling;
+		parent.child2 = leaf;
+		if (oldParent != InvalidNode)
+		{
+			if (nodes[oldParent].child1 == sibling) nodes[oldParent].child1 = newParent;
+			else nodes[oldParent].child2 = newParent;
+		}
+		else root = newParent;
+		nodes[sibling].parent = newParent;
+		nodes[leaf].parent = newParent;
+		FixUpwards(nodes[leaf].parent);
+	}
+	void AABBTree::RemoveLeaf(uint32_t leaf)
+	{
+		if (leaf == root)
+		{
+			root = InvalidNode;
+			return;
+		}
+		uint32_t parent = nodes[leaf].parent;
+		uint32_t grandParent = nodes[parent].parent;
+		uint32_t sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+		FreeNode(parent);
+		if (grandParent == InvalidNode)
+		{
+			root = sibling;
+			nodes[sibling].parent = InvalidNode;
+			return;
+		}
+		//the sibling takes the parent's place
+		if (nodes[grandParent].child1 == parent) nodes[grandParent].child1 = sibling;
+		else nodes[grandParent].child2 = sibling;
+		nodes[sibling].parent = grandParent;
+		FixUpwards(grandParent);
+	}
+	void AABBTree::FixUpwards(uint32_t index)
+	{
+		while (index != InvalidNode)
+		{
+			index = Balance(index);
+			AABBTreeNode& node = nodes[index];
+			const AABBTreeNode& c1 = nodes[node.child1];
+			const AABBTreeNode& c2 = nodes[node.child2];
+			node.height = 1 + std::max(c1.height, c2.height);
+			node.min = Min3(c1.min, c2.min);
+			node.max = Max3(c1.max, c2.max);
+			node.layers = c1.layers | c2.layers;
+			index = node.parent;
+		}
+	}
+	//rotates @a up if its children's heights differ by more than one, returns the node now in @a's place
+	uint32_t AABBTree::Balance(uint32_t a)
+	{
+		AABBTreeNode& A = nodes[a];
+		if (A.IsLeaf() || A.height < 2) return a;
+		uint32_t b = A.child1;
+		uint32_t c = A.child2;
+		int32_t balance = nodes[c].height - nodes[b].height;
+		if (balance > 1 || balance < -1)
+		{
+			//the taller child is promoted
+			uint32_t up = balance > 1 ? c : b;
+			uint32_t other = balance > 1 ? b : c;
+			AABBTreeNode& U = nodes[up];
+			uint32_t f = U.child1;
+			uint32_t g = U.child2;
+			U.child1 = a;
+			U.parent = A.parent;
+			A.parent = up;
+			if (U.parent != InvalidNode)
+			{
+				if (nodes[U.parent].child1 == a) nodes[U.parent].child1 = up;
+				else nodes[U.parent].child2 = up;
+			}
+			else root = up;
+			//the taller grandchild stays under the promoted node, the other one replaces it under @a
+			uint32_t keep = nodes[f].height > nodes[g].height ? f : g;
+			uint32_t give = keep == f ? g : f;
+			U.child2 = keep;
+			if (balance > 1) A.child2 = give;
+			else A.child1 = give;
+			nodes[give].parent = a;
+			A.min = Min3(nodes[other].min, nodes[give].min);
+			A.max = Max3(nodes[other].max, nodes[give].max);
+			A.layers = nodes[other].layers | nodes[give].layers;
+			A.height = 1 + std::max(nodes[other].height, nodes[give].height);
+			U.min = Min3(A.min, nodes[keep].min);
+			U.max = Max3(A.max, nodes[keep].max);
+			U.layers = A.layers | nodes[keep].layers;
+			U.height = 1 + std::max(A.height, nodes[keep].height);
+			return up;
+		}
+		return a;
+	}
+}
@@ -0,0 +1,179 @@
+#pragma once
+#include "Pistachio/Core/Math.h"
+#include "entt.hpp"
+#include <cstdint>
+#include <vector>
+namespace Pistachio
+{
+	struct PISTACHIO_API AABBTreeNode
+	{
+		//fat bounds, a leaf only has to be reinserted once its tight box leaves them
+		DirectX::XMFLOAT3 min;
+		DirectX::XMFLOAT3 max;
+		//exact bounds, only used by leaves
+		DirectX::XMFLOAT3 tightMin;
+		DirectX::XMFLOAT3 tightMax;
+		uint32_t parent;//doubles as the next link in the free list
+		uint32_t child1;
+		uint32_t child2;
+		int32_t height;//0 for leaves, -1 for free nodes
+		uint32_t layers;//union of the layers of every leaf below
+		entt::entity entity;
+		bool IsLeaf() const { return child1 == UINT32_MAX; }
+	};
+	/*
+	* Dynamic bounding volume hierarchy (AABB tree).
+	* Leaves are stored with a slightly enlarged box so small movements only update the tight box,
+	* leaves that escape their fat box are removed and reinserted with a surface area heuristic,
+	* and the tree is kept balanced with AVL style rotations.
+	* Every leaf carries a layer bit so one tree can hold different kinds of objects and queries can skip
+	* whole subtrees that hold none of the requested layers.
+	*/
+	class PISTACHIO_API AABBTree
+	{
+	public:
+		static constexpr uint32_t InvalidNode = UINT32_MAX;
+		static constexpr uint32_t MaxPlanes = 6;
+		uint32_t Insert(const BoundingBox& box, entt::entity entity, uint32_t layer);
+		void Remove(uint32_t leaf);
+		//updates the leaf's box, returns true if the leaf had to be reinserted
+		bool Move(uint32_t leaf, const BoundingBox& box);
+		void Clear();
+		/*
+		* Calls fn(entt::entity, uint32_t layer) for every leaf in @layerMask whose box isn't fully outside one of the @planes.
+		* Planes point outwards (like BoundingFrustum::GetPlanes), subtrees fully inside skip the plane tests.
+		* returns the number of nodes visited
+		*/
+		template<typename Fn>
+		uint32_t Query(const DirectX::XMFLOAT4* planes, uint32_t numPlanes, uint32_t layerMask, Fn&& fn) const;
+		/*
+		* Calls fn(entt::entity, uint32_t layer) for every leaf in @layerMask whose tight box passes @overlaps.
+		* overlaps(const XMFLOAT3& min, const XMFLOAT3& max) is also used to prune the inner nodes, so it must not miss boxes that touch the volume
+		* returns the number of nodes visited
+		*/
+		template<typename Overlap, typename Fn>
+		uint32_t QueryOverlap(Overlap&& overlaps, uint32_t layerMask, Fn&& fn) const;
+		/*
+		* Walks the leaves in @layerMask whose tight box is hit by the ray within @maxDistance, @direction must be normalized.
+		* fn(entt::entity, float boxDistance) returns the new max distance, returning a smaller value clips the rest of the walk
+		*/
+		template<typename Fn>
+		void Raycast(DirectX::FXMVECTOR origin, DirectX::FXMVECTOR direction, float maxDistance, uint32_t layerMask, Fn&& fn) const;
+		//returns the leaf entity in @layerMask whose tight box is closest to @point (0 when inside), or entt::null if none is within @maxDistance
+		entt::entity FindNearest(DirectX::FXMVECTOR point, float maxDistance, uint32_t layerMask, float* distance = nullptr) const;
+		//distance the ray enters the box at, 0 when it starts inside, or a negative value on a miss
+		static float RayBox(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& invDirection, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max, float maxDistance);
+		static void GetPlanes(const BoundingFrustum& frustum, DirectX::XMFLOAT4 planes[6]);
+		//planes of a view projection matrix with a [0, 1] depth range, works for orthographic matrices too
+		static void GetPlanes(DirectX::FXMMATRIX viewProj, DirectX::XMFLOAT4 planes[6]);
+		entt::entity GetEntity(uint32_t leaf) const { return nodes[leaf].entity; }
+		uint32_t GetHeight() const { return root == InvalidNode ? 0 : (uint32_t)nodes[root].height; }
+		uint32_t GetNumLeaves() const { return numLeaves; }
+	private:
+		enum class PlaneResult { Outside, Intersecting, Inside };
+		//tests @node against the planes set in @mask, clears the bits of planes it's fully inside of
+		static PlaneResult TestPlanes(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max, const DirectX::XMFLOAT4* planes, uint32_t& mask);
+		uint32_t AllocateNode();
+		void FreeNode(uint32_t node);
+		void InsertLeaf(uint32_t leaf);
+		void RemoveLeaf(uint32_t leaf);
+		//refits and rebalances every node from @node to the root
+		void FixUpwards(uint32_t node);
+		uint32_t Balance(uint32_t node);
+	private:
+		std::vector<AABBTreeNode> nodes;
+		uint32_t root = InvalidNode;
+		uint32_t freeList = InvalidNode;
+		uint32_t numLeaves = 0;
+	};
+	template<typename Fn>
+	uint32_t AABBTree::Query(const DirectX::XMFLOAT4* planes, uint32_t numPlanes, uint32_t layerMask, Fn&& fn) const
+	{
+		if (root == InvalidNode) return 0;
+		struct Entry { uint32_t node; uint32_t mask; };
+		//the tree is balanced, so the stack never holds more than a couple of entries per level
+		Entry stack[128];
+		uint32_t top = 0;
+		uint32_t visited = 0;
+		stack[top++] = { root, (1u << numPlanes) - 1 };
+		while (top)
+		{
+			Entry e = stack[--top];
+			const AABBTreeNode& node = nodes[e.node];
+			visited++;
+			if (!(node.layers & layerMask)) continue;
+			if (e.mask)
+			{
+				if (TestPlanes(node.min, node.max, planes, e.mask) == PlaneResult::Outside) continue;
+				if (node.IsLeaf() && e.mask && TestPlanes(node.tightMin, node.tightMax, planes, e.mask) == PlaneResult::Outside) continue;
+			}
+			if (node.IsLeaf())
+			{
+				fn(node.entity, node.layers);
+				continue;
+			}
+			stack[top++] = { node.child1, e.mask };
+			stack[top++] = { node.child2, e.mask };
+		}
+		return visited;
+	}
+	template<typename Overlap, typename Fn>
+	uint32_t AABBTree::QueryOverlap(Overlap&& overlaps, uint32_t layerMask, Fn&& fn) const
+	{
+		if (root == InvalidNode) return 0;
+		uint32_t stack[128];
+		uint32_t top = 0;
+		uint32_t visited = 0;
+		stack[top++] = root;
+		while (top)
+		{
+			const AABBTreeNode& node = nodes[stack[--top]];
+			visited++;
+			if (!(node.layers & layerMask) || !overlaps(node.min, node.max)) continue;
+			if (node.IsLeaf())
+			{
+				if (overlaps(node.tightMin, node.tightMax)) fn(node.entity, node.layers);
+				continue;
+			}
+			stack[top++] = node.child1;
+			stack[top++] = node.child2;
+		}
+		return visited;
+	}
+	template<typename Fn>
+	void AABBTree::Raycast(DirectX::FXMVECTOR origin, DirectX::FXMVECTOR direction, float maxDistance, uint32_t layerMask, Fn&& fn) const
+	{
+		if (root == InvalidNode) return;
+		DirectX::XMFLOAT3 o, invDir;
+		DirectX::XMStoreFloat3(&o, origin);
+		DirectX::XMStoreFloat3(&invDir, DirectX::XMVectorReciprocal(direction));
+		//entries carry the distance their fat box was entered at, so nodes behind a closer hit are dropped when popped
+		struct Entry { uint32_t node; float distance; };
+		Entry stack[128];
+		uint32_t top = 0;
+		float rootDistance = RayBox(o, invDir, nodes[root].min, nodes[root].max, maxDistance);
+		if (rootDistance >= 0.f) stack[top++] = { root, rootDistance };
+		while (top)
+		{
+			Entry e = stack[--top];
+			if (e.distance > maxDistance) continue;
+			const AABBTreeNode& node = nodes[e.node];
+			if (!(node.layers & layerMask)) continue;
+			if (node.IsLeaf())
+			{
+				float distance = RayBox(o, invDir, node.tightMin, node.tightMax, maxDistance);
+				if (distance >= 0.f) maxDistance = fn(node.entity, distance);
+				continue;
+			}
+			//push the nearer child last so it's walked first
+			const AABBTreeNode& c1 = nodes[node.child1];
+			const AABBTreeNode& c2 = nodes[node.child2];
+			float d1 = RayBox(o, invDir, c1.min, c1.max, maxDistance);
+			float d2 = RayBox(o, invDir, c2.min, c2.max, maxDistance);
+			Entry near = { node.child1, d1 }, far = { node.child2, d2 };
+			if (d2 >= 0.f && (d1 < 0.f || d2 < d1)) std::swap(near, far);
+			if (far.distance >= 0.f) stack[top++] = far;
+			if (near.distance >= 0.f) stack[top++] = near;
+		}
+	}
+}
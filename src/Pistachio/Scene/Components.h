@@ -1,171 +1,219 @@
-#pragma once
-#include <DirectXMath.h>
-#include <vector>
-#include "Pistachio/Core/Math.h"
-#include "Pistachio/Renderer/Camera.h"
-#include "Pistachio/Renderer/Mesh.h"
-#include "Pistachio/Renderer/ShadowMap.h"
-#include "Pistachio/Asset/AssetManager.h"
-#include "Pistachio/Allocators/AtlasAllocator.h"
-#include "Pistachio/Core/Property.h"
-#include "Entity.h"
-#include "Pistachio/Scene/Scene.h"
-namespace Pistachio{
-	// Generic ----------------------------------------------------------------------------------
-	struct PISTACHIO_API IDComponent
-	{
-		UUID uuid;
-		IDComponent() = default;
-		IDComponent(const IDComponent&) = default;
-		IDComponent(UUID uuid) : uuid(uuid)
-		{}
-	};
-	struct PISTACHIO_API HierarchyComponent {
-		entt::entity parentID = entt::null;
-		std::vector<entt::entity> chilren;
-	};
-	struct PISTACHIO_API TagComponent {
-		std::string Tag;
-		TagComponent() = default;
-		TagComponent(const TagComponent&) = default;
-		TagComponent(const std::string& tag) : Tag(tag)
-		{}
-
-	};
-
-	struct PISTACHIO_API TransformComponent {
-	private:
-	public:
-		Vector3 Translation = Vector3{ 0,0,0 };
-		Quaternion Rotation = Quaternion{ 0,0,0,0 };
-		Vector3 Scale = Vector3{ 1,1,1 };
-		//Editor Only
-		Vector3 RotationEulerHint = Vector3{ 0,0,0 };
-		mutable int NumNegativeScaleComps = 0;
-		TransformComponent() = default;
-		TransformComponent(const TransformComponent&) = default;
-		//Editor Only
-		DirectX::XMMATRIX worldSpaceTransform = DirectX::XMMatrixIdentity();
-		void RecalculateRotation()
-		{
-			Rotation = Quaternion::CreateFromYawPitchRoll(RotationEulerHint);
-		}
-		DirectX::XMMATRIX GetLocalTransform() const
-		{
-			NumNegativeScaleComps = 0;
-			for (int i = 0; i < 3; i++)
-				if (((float*)&Scale)[i] < 0) NumNegativeScaleComps++;
-			return (DirectX::XMMatrixScalingFromVector(Scale) * DirectX::XMMatrixRotationQuaternion(Rotation) * DirectX::XMMatrixTranslationFromVector(Translation));
-		}
-	};
-	//-----------------------------------------------------------------------------------------------------------------------
-
-	// 3D -------------------------------------------------------------------------------------------------------------------
-	struct PISTACHIO_API MeshRendererComponent {
-		Asset Model;
-		Asset material;
-		int modelIndex = 0;
-		bool bMaterialDirty = true;
-		RendererCBHandle handle;
-		~MeshRendererComponent() = default;
-		MeshRendererComponent() = default;
-		MeshRendererComponent(const MeshRendererComponent& other) = default;
-		MeshRendererComponent(const char* path) { 
-			Model = GetAssetManager()->CreateModelAsset(path).value_or(Asset{}); 
-		}
-	};
-	/**
-	 * @brief Environment configuration component, only to be used in the  root node
-	 * 
-	 */
-	struct PISTACHIO_API EnvironmentComponent {
-		Asset skybox;
-		enum class Type {
-			SkyboxTexture
-		};
-		Type type;
-	};
-	// ----------------------------------------------------------------------------------------------------------------------
-	struct PISTACHIO_API SpriteRendererComponent {
-		DirectX::XMFLOAT4 Color = {1.f,1.f,1.f, 1.f}; 
-		SpriteRendererComponent() = default;
-		SpriteRendererComponent(const SpriteRendererComponent&) = default;
-		SpriteRendererComponent(const DirectX::XMFLOAT4& color) : Color(color) {}
-		SpriteRendererComponent(const DirectX::XMVECTOR& color){DirectX::XMStoreFloat4(&Color, color); }
-	};
-	struct PISTACHIO_API CameraComponent {
-		SceneCamera camera;
-		bool Primary = true;
-		bool FixedAspectRatio = false;
-		CameraComponent() = default;
-		CameraComponent(const CameraComponent&) = default;
-	};
-	class PISTACHIO_API ScriptableComponent;
-	struct PISTACHIO_API NativeScriptComponent {
-		ScriptableComponent* Instance = nullptr;
-		
-		std::function<void()> InstantiateFunction;
-		std::function<void()> DestroyInstanceFunction;
-		std::function<void(ScriptableComponent*)> OnCreateFunction;
-		std::function<void(ScriptableComponent*)> OnDestroyFunction;
-		std::function<void(ScriptableComponent*, float delta)> OnUpdateFunction;
-		template<typename T>
-		void Bind()
-		{
-			InstantiateFunction = [&]() { Instance = new T(); };
-			DestroyInstanceFunction = [&]() { delete (T*)Instance; };
-			OnCreateFunction = [](ScriptableComponent* instance) { ((T*)instance)->OnCreate(); };
-			OnDestroyFunction = [](ScriptableComponent* instance) { ((T*)instance)->OnDestroy(); };
-			OnUpdateFunction = [](ScriptableComponent* instance, float delta) { ((T*)instance)->OnUpdate(delta); };
-		}
-	};
-	struct PISTACHIO_API LightComponent {
-		LightType Type;
-		float Intensity = 1.f;
-		DirectX::XMFLOAT3 color = {1,1,1};
-		bool shadow = false;
-		//for spot lights this holds the outercone and innercone angles(x,y) and the distance for both point and spot light (z)
-		DirectX::XMFLOAT3 exData = { 0.01f,0.1f,1.0f };
-		DirectX::XMFLOAT3 rotation = {};
-		uint32_t shadowMap;
-		LightComponent(const LightComponent& other)
-		{
-			Type = other.Type;
-			Intensity = other.Intensity;
-			color = other.color;
-			shadow = other.shadow;
-			exData = other.exData;
-			rotation = other.rotation;
-		};
-		LightComponent() = default;
-	};
-	// Physics---------------------------------------------------------------------------------------------------------------
-	struct PISTACHIO_API RigidBodyComponent {
-		enum class BodyType{Static, Dynamic, Kinematic};
-		BodyType type = BodyType::Static;
-		float Density = 10.f;
-		void* RuntimeBody = nullptr;
-		float StaticFriction = .5f;
-		float DynamicFriction = .5f;
-		float Restitution = .5f;
-	};
-	struct PISTACHIO_API BoxColliderComponent {
-		DirectX::XMFLOAT3 size = { 1.f, 1.f, 1.f };
-		DirectX::XMFLOAT3 offset = { .0f, .0f, .0f };
-		
-	};
-	struct PISTACHIO_API SphereColliderComponent {
-		float size = 1.f;
-		DirectX::XMFLOAT3 offset = { .0f, .0f, .0f };
-	};
-	struct PISTACHIO_API CapsuleColliderComponent {
-		float radius = 1.f;
-		float height;
-		DirectX::XMFLOAT3 offset = { .0f, .0f, .0f };
-	};
-	struct PISTACHIO_API PlaneColliderComponent {
-		float size = 1.f;
-		DirectX::XMFLOAT3 offset = { .0f, .0f, .0f };
-	};
-	// -----------------------------------------------------------------------------------------------------------------------
-}
+#pragma once
+#include <DirectXMath.h>
+#include <vector>
+#include "Pistachio/Core/Math.h"
+#include "Pistachio/Renderer/Camera.h"
+#include "Pistachio/Renderer/Mesh.h"
+#include "Pistachio/Renderer/ShadowMap.h"
+#include "Pistachio/Asset/AssetManager.h"
+#include "Pistachio/Allocators/AtlasAllocator.h"
+#include "Pistachio/Core/Property.h"
+#include "Entity.h"
+#include "Pistachio/Scene/Scene.h"
+namespace Pistachio{
+	// Generic ----------------------------------------------------------------------------------
+	struct PISTACHIO_API IDComponent
+	{
+		UUID uuid;
+		IDComponent() = default;
+		IDComponent(const IDComponent&) = default;
+		IDComponent(UUID uuid) : uuid(uuid)
+		{}
+	};
+	struct PISTACHIO_API HierarchyComponent {
+		entt::entity parentID = entt::null;
+		uint32_t node = TransformHierarchy::InvalidNode;//node in the scene's TransformHierarchy, children are iterated from there
+	};
+	struct PISTACHIO_API TagComponent {
+		std::string Tag;
+		TagComponent() = default;
+		TagComponent(const TagComponent&) = default;
+		TagComponent(const std::string& tag) : Tag(tag)
+		{}
+
+	};
+
+	struct PISTACHIO_API TransformComponent {
+	public:
+		//declared before the properties, which notify while they are constructed
+		bool bDirty = true;
+		entt::entity entity = entt::null;//owned by the scene, reassigned on construction and kept by copies
+		std::vector<entt::entity>* dirtyList = nullptr;//the scene's dirty transforms, owned by the scene, reassigned on construction and kept by copies
+		/*
+		* Translation, Rotation and Scale are properties so any write marks the component dirty and queues it on the scene,
+		* the scene then only recomputes world transforms of queued nodes and everything below them
+		*/
+		VEC3(TransformComponent, Translation, ) = Vector3{ 0,0,0 };
+		QUAT(TransformComponent, Rotation, ) = Quaternion{ 0,0,0,0 };
+		VEC3(TransformComponent, Scale, ) = Vector3{ 1,1,1 };
+		/*
+		* Static objects are expected to stay where they were placed, the scene still follows them if they move
+		* but counts it, and consumers can cache anything derived from static geometry until GetStaticGeometryVersion changes
+		*/
+		enum class Mobility { Static, Dynamic };
+		Mobility mobility = Mobility::Dynamic;
+		//Editor Only
+		Vector3 RotationEulerHint = Vector3{ 0,0,0 };
+		mutable int NumNegativeScaleComps = 0;
+		TransformComponent() = default;
+		//copies only the transform, the copy stays on its own entity and is queued like any other write
+		TransformComponent(const TransformComponent& other) { CopyTransform(other); }
+		TransformComponent& operator=(const TransformComponent& other)
+		{
+			CopyTransform(other);
+			MarkDirty();
+			return *this;
+		}
+		//the registry moves components around its storage, those keep their entity
+		TransformComponent(TransformComponent&&) = default;
+		TransformComponent& operator=(TransformComponent&&) = default;
+		//Editor Only
+		DirectX::XMMATRIX worldSpaceTransform = DirectX::XMMatrixIdentity();
+		//queued at most once between two scene updates
+		void MarkDirty()
+		{
+			if (bDirty) return;
+			bDirty = true;
+			if (dirtyList) dirtyList->push_back(entity);
+		}
+		void RecalculateRotation()
+		{
+			Rotation = Quaternion::CreateFromYawPitchRoll(RotationEulerHint);
+		}
+		DirectX::XMMATRIX GetLocalTransform() const
+		{
+			NumNegativeScaleComps = 0;
+			Vector3 scale = Scale;
+			for (int i = 0; i < 3; i++)
+				if ((&scale.x)[i] < 0) NumNegativeScaleComps++;
+			return (DirectX::XMMatrixScalingFromVector(scale) * DirectX::XMMatrixRotationQuaternion(Rotation) * DirectX::XMMatrixTranslationFromVector(Translation));
+		}
+	private:
+		//copying the properties themselves doesn't notify
+		void CopyTransform(const TransformComponent& other)
+		{
+			Translation = other.Translation;
+			Rotation = other.Rotation;
+			Scale = other.Scale;
+			mobility = other.mobility;
+			RotationEulerHint = other.RotationEulerHint;
+			NumNegativeScaleComps = other.NumNegativeScaleComps;
+			worldSpaceTransform = other.worldSpaceTransform;
+		}
+	};
+	//-----------------------------------------------------------------------------------------------------------------------
+
+	// 3D -------------------------------------------------------------------------------------------------------------------
+	struct PISTACHIO_API MeshRendererComponent {
+		Asset Model;
+		Asset material;
+		int modelIndex = 0;
+		bool occluder = false;//drawn into the scene's software occlusion buffer to hide the meshes behind it, meant for large simple meshes
+		bool bMaterialDirty = true;
+		bool bObjectDataDirty = true;//set when the world transform changes, cleared once the object data is handed to the gpu scene, which keeps a dirty bit per frame in flight
+		uint32_t objectID = GPUScene::InvalidID;//slot in the scene's gpu scene, owned by the scene, reassigned on construction
+		uint32_t boundsSlot = WorldBounds::InvalidSlot;//owned by the scene, reassigned on construction
+		uint32_t treeNode = AABBTree::InvalidNode;//leaf in the scene's aabb tree, invalid while there's no model box
+		~MeshRendererComponent() = default;
+		MeshRendererComponent() = default;
+		MeshRendererComponent(const MeshRendererComponent& other) = default;
+		MeshRendererComponent(const char* path) { 
+			Model = GetAssetManager()->CreateModelAsset(path).value_or(Asset{}); 
+		}
+	};
+	/**
+	 * @brief Environment configuration component, only to be used in the  root node
+	 * 
+	 */
+	struct PISTACHIO_API EnvironmentComponent {
+		Asset skybox;
+		enum class Type {
+			SkyboxTexture
+		};
+		Type type;
+	};
+	// ----------------------------------------------------------------------------------------------------------------------
+	struct PISTACHIO_API SpriteRendererComponent {
+		DirectX::XMFLOAT4 Color = {1.f,1.f,1.f, 1.f}; 
+		SpriteRendererComponent() = default;
+		SpriteRendererComponent(const SpriteRendererComponent&) = default;
+		SpriteRendererComponent(const DirectX::XMFLOAT4& color) : Color(color) {}
+		SpriteRendererComponent(const DirectX::XMVECTOR& color){DirectX::XMStoreFloat4(&Color, color); }
+	};
+	struct PISTACHIO_API CameraComponent {
+		SceneCamera camera;
+		bool Primary = true;
+		bool FixedAspectRatio = false;
+		CameraComponent() = default;
+		CameraComponent(const CameraComponent&) = default;
+	};
+	class PISTACHIO_API ScriptableComponent;
+	struct PISTACHIO_API NativeScriptComponent {
+		ScriptableComponent* Instance = nullptr;
+		
+		std::function<void()> InstantiateFunction;
+		std::function<void()> DestroyInstanceFunction;
+		std::function<void(ScriptableComponent*)> OnCreateFunction;
+		std::function<void(ScriptableComponent*)> OnDestroyFunction;
+		std::function<void(ScriptableComponent*, float delta)> OnUpdateFunction;
+		template<typename T>
+		void Bind()
+		{
+			InstantiateFunction = [&]() { Instance = new T(); };
+			DestroyInstanceFunction = [&]() { delete (T*)Instance; };
+			OnCreateFunction = [](ScriptableComponent* instance) { ((T*)instance)->OnCreate(); };
+			OnDestroyFunction = [](ScriptableComponent* instance) { ((T*)instance)->OnDestroy(); };
+			OnUpdateFunction = [](ScriptableComponent* instance, float delta) { ((T*)instance)->OnUpdate(delta); };
+		}
+	};
+	struct PISTACHIO_API LightComponent {
+		LightType Type;
+		float Intensity = 1.f;
+		DirectX::XMFLOAT3 color = {1,1,1};
+		bool shadow = false;
+		//for spot lights this holds the outercone and innercone angles(x,y) and the distance for both point and spot light (z)
+		DirectX::XMFLOAT3 exData = { 0.01f,0.1f,1.0f };
+		DirectX::XMFLOAT3 rotation = {};
+		uint32_t shadowMap;
+		uint32_t treeNode = AABBTree::InvalidNode;//leaf in the scene's aabb tree, directional lights have none, reset on construction so copies get their own
+		LightComponent(const LightComponent& other)
+		{
+			Type = other.Type;
+			Intensity = other.Intensity;
+			color = other.color;
+			shadow = other.shadow;
+			exData = other.exData;
+			rotation = other.rotation;
+		};
+		LightComponent() = default;
+	};
+	// Physics---------------------------------------------------------------------------------------------------------------
+	struct PISTACHIO_API RigidBodyComponent {
+		enum class BodyType{Static, Dynamic, Kinematic};
+		BodyType type = BodyType::Static;
+		float Density = 10.f;
+		void* RuntimeBody = nullptr;
+		float StaticFriction = .5f;
+		float DynamicFriction = .5f;
+		float Restitution = .5f;
+	};
+	struct PISTACHIO_API BoxColliderComponent {
+		DirectX::XMFLOAT3 size = { 1.f, 1.f, 1.f };
+		DirectX::XMFLOAT3 offset = { .0f, .0f, .0f };
+		
+	};
+	struct PISTACHIO_API SphereColliderComponent {
+		float size = 1.f;
+		DirectX::XMFLOAT3 offset = { .0f, .0f, .0f };
+	};
+	struct PISTACHIO_API CapsuleColliderComponent {
+		float radius = 1.f;
+		float height;
+		DirectX::XMFLOAT3 offset = { .0f, .0f, .0f };
+	};
+	struct PISTACHIO_API PlaneColliderComponent {
+		float size = 1.f;
+		DirectX::XMFLOAT3 offset = { .0f, .0f, .0f };
+	};
+	// -----------------------------------------------------------------------------------------------------------------------
+}
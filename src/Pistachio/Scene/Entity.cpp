@@ -1,12 +1,12 @@
-#include "ptpch.h"
-#include "entt.hpp"
-#include "Entity.h"
-namespace Pistachio {
-	Entity::Entity(entt::entity handle, Scene* scene)
-		: m_Scene(scene),
-		m_EntityHandle(handle),
-		version(m_Scene->m_Registry.current(m_EntityHandle))
-	{
-		
-	}
+#include "ptpch.h"
+#include "entt.hpp"
+#include "Entity.h"
+namespace Pistachio {
+	Entity::Entity(entt::entity handle, Scene* scene)
+		: m_Scene(scene),
+		m_EntityHandle(handle),
+		version(m_Scene->m_Registry.current(m_EntityHandle))
+	{
+		
+	}
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include "Pistachio/Scene/AABBTree.h"
+namespace Pistachio
+{
+	/*
+	* Leaves of the point and spot lights in the scene's aabb tree. A light component owns the leaf in its treeNode,
+	* so a component constructed from another one (a duplicated entity) has to drop the copied index with Reset,
+	* otherwise both would move and later remove the same leaf.
+	* @Light is anything with the treeNode of a LightComponent.
+	*/
+	class PISTACHIO_API LightBounds
+	{
+	public:
+		template<typename Light>
+		static void Reset(Light& light) { light.treeNode = AABBTree::InvalidNode; }
+		//puts @light's leaf at @box, inserting it on the first call
+		template<typename Light>
+		static void Sync(AABBTree& tree, Light& light, entt::entity entity, const BoundingBox& box, uint32_t layer)
+		{
+			if (light.treeNode == AABBTree::InvalidNode) light.treeNode = tree.Insert(box, entity, layer);
+			else tree.Move(light.treeNode, box);
+		}
+		//directional lights and destroyed components have no leaf
+		template<typename Light>
+		static void Remove(AABBTree& tree, Light& light)
+		{
+			if (light.treeNode != AABBTree::InvalidNode) tree.Remove(light.treeNode);
+			light.treeNode = AABBTree::InvalidNode;
+		}
+	};
+}
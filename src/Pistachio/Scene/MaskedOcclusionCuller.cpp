@@ -0,0 +1,249 @@
+#include "ptpch.h"
+#include "MaskedOcclusionCuller.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace Pistachio
+{
+	//bits [first, last) of a tile row
+	static uint32_t RowBits(int first, int last)
+	{
+		first = std::max(first, 0);
+		last = std::min(last, (int)MaskedOcclusionCuller::TileWidth);
+		if (first >= last) return 0;
+		uint32_t high = last == (int)MaskedOcclusionCuller::TileWidth ? ~0u : (1u << last) - 1;
+		return high & ~((1u << first) - 1);
+	}
+	void MaskedOcclusionCuller::SetResolution(uint32_t width, uint32_t height)
+	{
+		numTilesX = std::max((width + TileWidth - 1) / TileWidth, 1u);
+		numTilesY = std::max((height + TileHeight - 1) / TileHeight, 1u);
+		tiles.resize(numTilesX * numTilesY);
+	}
+	void MaskedOcclusionCuller::Begin(DirectX::FXMMATRIX viewProj)
+	{
+		DirectX::XMStoreFloat4x4(&this->viewProj, viewProj);
+		std::fill(tiles.begin(), tiles.end(), Tile{ { 0, 0, 0, 0 }, 1.f, 0.f });
+		stats = {};
+	}
+	void MaskedOcclusionCuller::RenderTriangles(const float* positions, uint32_t numVertices, uint32_t stride, const uint32_t* indices, uint32_t numIndices, DirectX::FXMMATRIX world)
+	{
+		PT_PROFILE_FUNCTION();
+		using namespace DirectX;
+		XMMATRIX toClip = XMMatrixMultiply(world, XMLoadFloat4x4(&viewProj));
+		clipVertices.resize(numVertices);
+		const uint8_t* src = (const uint8_t*)positions;
+		for (uint32_t i = 0; i < numVertices; i++)
+			XMStoreFloat4(&clipVertices[i], XMVector3Transform(XMLoadFloat3((const XMFLOAT3*)(src + i * stride)), toClip));
+		float width = (float)GetWidth();
+		float height = (float)GetHeight();
+		for (uint32_t i = 0; i + 2 < numIndices; i += 3)
+		{
+			XMFLOAT3 screen[3];
+			bool clipped = false;
+			for (uint32_t k = 0; k < 3 && !clipped; k++)
+			{
+				const XMFLOAT4& c = clipVertices[indices[i + k]];
+				//triangles crossing the near plane are dropped instead of clipped, which only loses occlusion
+				clipped = c.w <= 0.f || c.z < 0.f;
+				if (clipped) break;
+				float invW = 1.f / c.w;
+				screen[k] = { (c.x * invW * 0.5f + 0.5f) * width, (0.5f - c.y * invW * 0.5f) * height, c.z * invW };
+			}
+			if (clipped)
+			{
+				stats.numTrianglesSkipped++;
+				continue;
+			}
+			RasterizeTriangle(screen);
+		}
+	}
+	void MaskedOcclusionCuller::RasterizeTriangle(const DirectX::XMFLOAT3* v)
+	{
+		using namespace DirectX;
+		XMFLOAT3 p0 = v[0], p1 = v[1], p2 = v[2];
+		float area = (p1.x - p0.x) * (p2.y - p0.y) - (p2.x - p0.x) * (p1.y - p0.y);
+		if (std::abs(area) < 1e-6f)
+		{
+			stats.numTrianglesSkipped++;
+			return;
+		}
+		//both windings are drawn, the edges below expect a positive area
+		if (area < 0.f)
+		{
+			std::swap(p1, p2);
+			area = -area;
+		}
+		int width = (int)GetWidth();
+		int height = (int)GetHeight();
+		//pixels whose center is inside the triangle's rectangle, clamped before the int conversion since vertices near the camera plane project far away
+		float minX = std::min({ p0.x, p1.x, p2.x }), maxX = std::max({ p0.x, p1.x, p2.x });
+		float minY = std::min({ p0.y, p1.y, p2.y }), maxY = std::max({ p0.y, p1.y, p2.y });
+		int xMin = std::max((int)std::ceil(std::clamp(minX - 0.5f, -1.f, (float)width)), 0);
+		int xMax = std::min((int)std::floor(std::clamp(maxX - 0.5f, -1.f, (float)width)), width - 1);
+		int yMin = std::max((int)std::ceil(std::clamp(minY - 0.5f, -1.f, (float)height)), 0);
+		int yMax = std::min((int)std::floor(std::clamp(maxY - 0.5f, -1.f, (float)height)), height - 1);
+		if (xMin > xMax || yMin > yMax)
+		{
+			stats.numTrianglesSkipped++;
+			return;
+		}
+		stats.numTrianglesRasterized++;
+		//depth plane z(x, y) = p0.z + dzdx * (x - p0.x) + dzdy * (y - p0.y)
+		float dzdx = ((p1.z - p0.z) * (p2.y - p0.y) - (p2.z - p0.z) * (p1.y - p0.y)) / area;
+		float dzdy = ((p2.z - p0.z) * (p1.x - p0.x) - (p1.z - p0.z) * (p2.x - p0.x)) / area;
+		float zFarthest = std::max({ p0.z, p1.z, p2.z });
+
+		/*
+		* Edge a->b keeps the pixels where cross(b - a, p - a) >= 0, solved for x on a row that's a bound k0 + k1 * y:
+		* a lower bound when the edge goes up the screen, an upper one when it goes down,
+		* horizontal edges don't bound x and instead keep or drop whole rows (k0 + k1 * y >= 0)
+		*/
+		const XMFLOAT3* points[3] = { &p0, &p1, &p2 };
+		XMVECTOR k0[3], k1[3];
+		int side[3];
+		for (uint32_t e = 0; e < 3; e++)
+		{
+			const XMFLOAT3& a = *points[e];
+			const XMFLOAT3& b = *points[(e + 1) % 3];
+			float dx = b.x - a.x, dy = b.y - a.y;
+			if (dy == 0.f)
+			{
+				side[e] = 0;
+				k0[e] = XMVectorReplicate(-dx * a.y);
+				k1[e] = XMVectorReplicate(dx);
+				continue;
+			}
+			side[e] = dy < 0.f ? 1 : -1;
+			k0[e] = XMVectorReplicate(a.x - dx * a.y / dy);
+			k1[e] = XMVectorReplicate(dx / dy);
+		}
+		const XMVECTOR rowCenters = XMVectorSet(0.5f, 1.5f, 2.5f, 3.5f);
+		const XMVECTOR half = XMVectorReplicate(0.5f);
+		const XMVECTOR lowest = XMVectorReplicate(-1.f);
+		const XMVECTOR highest = XMVectorReplicate((float)width);
+		for (int ty = yMin / (int)TileHeight; ty <= yMax / (int)TileHeight; ty++)
+		{
+			int y0 = ty * (int)TileHeight;
+			//the 4 rows of the tile row are solved at once
+			XMVECTOR y = XMVectorAdd(XMVectorReplicate((float)y0), rowCenters);
+			XMVECTOR left = lowest;
+			XMVECTOR right = highest;
+			for (uint32_t e = 0; e < 3; e++)
+			{
+				XMVECTOR bound = XMVectorMultiplyAdd(k1[e], y, k0[e]);
+				if (side[e] > 0) left = XMVectorMax(left, bound);
+				else if (side[e] < 0) right = XMVectorMin(right, bound);
+				else right = XMVectorSelect(right, lowest, XMVectorLess(bound, XMVectorZero()));
+			}
+			XMINT4 first, last;
+			XMStoreSInt4(&first, XMVectorCeiling(XMVectorClamp(XMVectorSubtract(left, half), lowest, highest)));
+			XMStoreSInt4(&last, XMVectorFloor(XMVectorClamp(XMVectorSubtract(right, half), lowest, highest)));
+			const int32_t* firstX = &first.x;
+			const int32_t* lastX = &last.x;
+			float rowTop = std::max((float)y0, minY);
+			float rowBottom = std::min((float)(y0 + (int)TileHeight), maxY);
+			for (int tx = xMin / (int)TileWidth; tx <= xMax / (int)TileWidth; tx++)
+			{
+				int x0 = tx * (int)TileWidth;
+				uint32_t coverage[TileHeight];
+				uint32_t any = 0;
+				for (int r = 0; r < (int)TileHeight; r++)
+				{
+					bool inside = y0 + r >= yMin && y0 + r <= yMax;
+					coverage[r] = inside ? RowBits(std::max(firstX[r], xMin) - x0, std::min(lastX[r], xMax) - x0 + 1) : 0;
+					any |= coverage[r];
+				}
+				if (!any) continue;
+				//farthest depth of the plane over the part of the tile the triangle can touch
+				float tileLeft = std::max((float)x0, minX);
+				float tileRight = std::min((float)(x0 + (int)TileWidth), maxX);
+				float z = p0.z + std::max(dzdx * (tileLeft - p0.x), dzdx * (tileRight - p0.x)) + std::max(dzdy * (rowTop - p0.y), dzdy * (rowBottom - p0.y));
+				UpdateTile(tiles[ty * numTilesX + tx], coverage, std::min(z, zFarthest));
+			}
+		}
+	}
+	void MaskedOcclusionCuller::UpdateTile(Tile& tile, const uint32_t* coverage, float z)
+	{
+		//already behind everything the tile holds
+		if (z >= tile.zMax0) return;
+		stats.numTileUpdates++;
+		//a triangle closer to the tile's far layer than to the working one starts a new working layer,
+		//dropping the old bits only gives up occlusion, merging would push the working depth back
+		if (z - tile.zMax1 > tile.zMax0 - z)
+		{
+			tile.zMax1 = 0.f;
+			for (uint32_t r = 0; r < TileHeight; r++) tile.mask[r] = 0;
+		}
+		tile.zMax1 = std::max(tile.zMax1, z);
+		uint32_t full = ~0u;
+		for (uint32_t r = 0; r < TileHeight; r++)
+		{
+			tile.mask[r] |= coverage[r];
+			full &= tile.mask[r];
+		}
+		//a fully covered working layer becomes the whole tile's
+		if (full == ~0u)
+		{
+			tile.zMax0 = tile.zMax1;
+			tile.zMax1 = 0.f;
+			for (uint32_t r = 0; r < TileHeight; r++) tile.mask[r] = 0;
+		}
+	}
+	bool MaskedOcclusionCuller::IsOccluded(const BoundingBox& box) const
+	{
+		using namespace DirectX;
+		XMMATRIX m = XMLoadFloat4x4(&viewProj);
+		XMFLOAT3 corners[BoundingBox::CORNER_COUNT];
+		box.GetCorners(corners);
+		float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+		float nearest = FLT_MAX;
+		float width = (float)GetWidth();
+		float height = (float)GetHeight();
+		for (const XMFLOAT3& corner : corners)
+		{
+			XMFLOAT4 c;
+			XMStoreFloat4(&c, XMVector3Transform(XMLoadFloat3(&corner), m));
+			if (c.w <= 0.f || c.z < 0.f) return false;
+			float invW = 1.f / c.w;
+			float x = (c.x * invW * 0.5f + 0.5f) * width;
+			float y = (0.5f - c.y * invW * 0.5f) * height;
+			minX = std::min(minX, x); maxX = std::max(maxX, x);
+			minY = std::min(minY, y); maxY = std::max(maxY, y);
+			nearest = std::min(nearest, c.z * invW);
+		}
+		//every pixel the rectangle touches, off screen boxes are left to frustum culling
+		minX = std::max(minX, 0.f); maxX = std::min(maxX, width);
+		minY = std::max(minY, 0.f); maxY = std::min(maxY, height);
+		if (minX >= maxX || minY >= maxY) return false;
+		int x0 = (int)minX, x1 = (int)std::ceil(maxX) - 1;
+		int y0 = (int)minY, y1 = (int)std::ceil(maxY) - 1;
+		const XMVECTOR rowOffsets = XMVectorSet(0.f, 1.f, 2.f, 3.f);
+		const XMVECTOR top = XMVectorReplicate((float)y0);
+		const XMVECTOR bottom = XMVectorReplicate((float)y1);
+		for (int ty = y0 / (int)TileHeight; ty <= y1 / (int)TileHeight; ty++)
+		{
+			//all ones on the rows of the tile the rectangle covers
+			XMVECTOR rows = XMVectorAdd(XMVectorReplicate((float)(ty * (int)TileHeight)), rowOffsets);
+			XMVECTOR rowMask = XMVectorAndInt(XMVectorGreaterOrEqual(rows, top), XMVectorLessOrEqual(rows, bottom));
+			for (int tx = x0 / (int)TileWidth; tx <= x1 / (int)TileWidth; tx++)
+			{
+				const Tile& tile = tiles[ty * numTilesX + tx];
+				int tileX = tx * (int)TileWidth;
+				XMVECTOR rect = XMVectorAndInt(XMVectorReplicateInt(RowBits(x0 - tileX, x1 - tileX + 1)), rowMask);
+				XMVECTOR mask = XMLoadInt4(tile.mask);
+				//pixels of the working layer are behind zMax1, the others behind zMax0
+				if (nearest < tile.zMax1 && !XMVector4EqualInt(XMVectorAndInt(rect, mask), XMVectorZero())) return false;
+				if (nearest < tile.zMax0 && !XMVector4EqualInt(XMVectorAndCInt(rect, mask), XMVectorZero())) return false;
+			}
+		}
+		return true;
+	}
+	float MaskedOcclusionCuller::GetPixelDepth(uint32_t x, uint32_t y) const
+	{
+		const Tile& tile = tiles[(y / TileHeight) * numTilesX + x / TileWidth];
+		bool covered = (tile.mask[y % TileHeight] >> (x % TileWidth)) & 1;
+		return covered ? tile.zMax1 : tile.zMax0;
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "Pistachio/Core/Math.h"
+#include <cstdint>
+#include <vector>
+namespace Pistachio
+{
+	/*
+	* Low resolution software depth buffer, rasterized on the cpu from a few large occluders and used to
+	* reject boxes hidden behind them before they are drawn.
+	* The screen is split in 32x4 pixel tiles and a tile doesn't store per pixel depth, only a coverage bit
+	* per pixel and two depths: zMax0, the farthest depth over the whole tile, and zMax1, the farthest depth
+	* of the partly covered layer the bits belong to. Triangles are merged into those layers, when the bits
+	* fill up the working layer becomes the whole tile's. Every depth kept is the farthest one of what was
+	* drawn, so a box is only reported occluded when it's behind the occluders on every pixel it covers.
+	* Depth is post projection z/w, 0 on the near plane, smaller is nearer.
+	*/
+	class PISTACHIO_API MaskedOcclusionCuller
+	{
+	public:
+		static constexpr uint32_t TileWidth = 32;
+		static constexpr uint32_t TileHeight = 4;
+		struct Stats
+		{
+			uint32_t numTrianglesRasterized = 0;
+			uint32_t numTrianglesSkipped = 0;//degenerate, off screen or crossing the near plane
+			uint32_t numTileUpdates = 0;
+		};
+		//@width is rounded up to a multiple of TileWidth and @height to a multiple of TileHeight
+		void SetResolution(uint32_t width, uint32_t height);
+		//empties every tile and resets the stats, @viewProj maps world space row vectors to clip space
+		void Begin(DirectX::FXMMATRIX viewProj);
+		/*
+		* Rasterizes an indexed triangle list, both windings are drawn
+		* @positions points at the x,y,z floats of the first vertex, the following ones are @stride bytes apart
+		*/
+		void RenderTriangles(const float* positions, uint32_t numVertices, uint32_t stride, const uint32_t* indices, uint32_t numIndices, DirectX::FXMMATRIX world);
+		//true when every pixel @box covers is behind what was rasterized, boxes crossing the near plane are never occluded
+		bool IsOccluded(const BoundingBox& box) const;
+		//farthest depth the buffer knows at pixel (@x, @y), 1 where nothing was drawn
+		float GetPixelDepth(uint32_t x, uint32_t y) const;
+		uint32_t GetWidth() const { return numTilesX * TileWidth; }
+		uint32_t GetHeight() const { return numTilesY * TileHeight; }
+		const Stats& GetStats() const { return stats; }
+	private:
+		struct Tile
+		{
+			uint32_t mask[TileHeight];//a bit per pixel of the working layer, x is the bit index
+			float zMax0;
+			float zMax1;
+		};
+		//@v holds screen space x, y (pixels, y down) and depth
+		void RasterizeTriangle(const DirectX::XMFLOAT3* v);
+		void UpdateTile(Tile& tile, const uint32_t* coverage, float z);
+	private:
+		DirectX::XMFLOAT4X4 viewProj;
+		std::vector<Tile> tiles;
+		std::vector<DirectX::XMFLOAT4> clipVertices;//scratch, clip space vertices of the mesh being rasterized
+		uint32_t numTilesX = 0, numTilesY = 0;
+		Stats stats;
+	};
+}
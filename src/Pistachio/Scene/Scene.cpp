@@ -1,1050 +1,2126 @@
-#include "CommandList.h"
-#include "DirectXMath.h"
-#include "FormatsAndTypes.h"
-#include "Pistachio/Debug/Instrumentor.h"
-#include "Pistachio/Renderer/BufferHandles.h"
-#include "Pistachio/Renderer/Mesh.h"
-#include "Pistachio/Renderer/RenderGraph.h"
-#include "Pistachio/Renderer/Renderer.h"
-#include "Pistachio/Renderer/RendererBase.h"
-#include "Pistachio/Renderer/RendererContext.h"
-#include "ptpch.h"
-#include "Pistachio/Core/Math.h"
-#include <algorithm>
-#include <cstdint>
-#include "Scene.h"
-#include "Components.h"
-#include "Pistachio/Renderer/Renderer2D.h"
-
-#include "Entity.h"
-#ifdef IMGUI
-#include "imgui.h"
-#include "ImGuizmo.h"
-
-#endif // IMGUI
-
-#include <Pistachio/Renderer/Skybox.h>
-
-#include "ScriptableComponent.h"
-#include "Pistachio/Physics/Physics.h"
-#include "Pistachio/Renderer/MeshFactory.h"
-#include "CullingManager.h"
-#include "../Renderer/Material.h"
-
-static void getFrustumCornersWorldSpace(const DirectX::XMMATRIX& proj, const DirectX::XMMATRIX& view, DirectX::XMVECTOR* corners)
-{
-	PT_PROFILE_FUNCTION();
-	const auto inv = DirectX::XMMatrixInverse(nullptr, view * proj);
-	int index = 0;
-	for (unsigned int x = 0; x < 2; ++x)
-	{
-		for (unsigned int y = 0; y < 2; ++y)
-		{
-			for (unsigned int z = 0; z < 2; ++z)
-			{
-				auto pt = DirectX::XMVector4Transform(DirectX::XMVectorSet(2.0f * x - 1.0f, 2.0f * y - 1.0f, 2.0f * z - 1.0f, 1.0f), inv);
-				corners[index] = DirectX::XMVectorScale(pt, 1.f/DirectX::XMVectorGetW(pt));
-				index++;
-			}
-		}
-	}
-}
-static DirectX::XMMATRIX GetLightMatrixFromCamera(const DirectX::XMMATRIX& camView, const DirectX::XMMATRIX& camProj, const Pistachio::Light& light, float zMult)
-{
-	PT_PROFILE_FUNCTION();
-	DirectX::XMVECTOR corners[8];
-	getFrustumCornersWorldSpace(camProj, camView, corners);
-	DirectX::XMVECTOR center = DirectX::XMVectorZero();
-	for (const auto& v : corners)
-	{
-		center = DirectX::XMVectorAdd(v, center);
-	}
-	center = DirectX::XMVectorScale(center, 1.f / 8.f);
-
-	const auto lightView = DirectX::XMMatrixLookAtLH(DirectX::XMVectorAdd(center, DirectX::XMLoadFloat4(&light.rotation)),
-		center,
-		DirectX::XMVectorSet(0.0f, 1.0f, 0.0f, 1.f));
-	float minX = std::numeric_limits<float>::max();
-	float maxX = std::numeric_limits<float>::lowest();
-	float minY = std::numeric_limits<float>::max();
-	float maxY = std::numeric_limits<float>::lowest();
-	float minZ = std::numeric_limits<float>::max();
-	float maxZ = std::numeric_limits<float>::lowest();
-	for (const auto& v : corners)
-	{
-		DirectX::XMVECTOR trf_xmv = DirectX::XMVector4Transform(v, lightView);
-		DirectX::XMFLOAT3 trf;
-		DirectX::XMStoreFloat3(&trf, trf_xmv);
-		minX = std::min(minX, trf.x);
-		maxX = std::max(maxX, trf.x);
-		minY = std::min(minY, trf.y);
-		maxY = std::max(maxY, trf.y);
-		minZ = std::min(minZ, trf.z);
-		maxZ = std::max(maxZ, trf.z);
-	}
-	if (minZ < 0)
-	{
-		minZ *= zMult;
-	}
-	else
-	{
-		minZ /= zMult;
-	}
-	if (maxZ < 0)
-	{
-		maxZ /= zMult;
-	}
-	else
-	{
-		maxZ *= zMult;
-	}
-
-	const DirectX::XMMATRIX lightProjection = DirectX::XMMatrixOrthographicOffCenterLH(minX, maxX, minY, maxY, minZ, maxZ);
-	return DirectX::XMMatrixMultiplyTranspose(lightView, lightProjection);
-}
-static const uint32_t clusterAABBsize = ((sizeof(float) * 4) * 2);
-namespace Pistachio {
-	void OnMeshRendererAdded(entt::registry & reg, entt::entity e)
-	{
-		MeshRendererComponent& component = reg.get<MeshRendererComponent>(e);
-		TransformData td;
-		td.transform = Matrix4::Identity;
-		td.normal = Matrix4::Identity;
-		component.handle =  Renderer::AllocateConstantBuffer(sizeof(TransformData));
-		Renderer::FullCBUpdate(component.handle, &td);
-	}
-	Scene::Scene(SceneDesc desc) : sm_allocator({ 4096, 4096 }, { 256, 256 })
-	{
-		MeshFactory::CreateCube();
-		PT_PROFILE_FUNCTION();
-		using namespace DirectX;
-		AssetManager* assetMan = GetAssetManager();
-		root = CreateRootEntity(UUID());
-
-		m_Registry.on_construct<MeshRendererComponent>().connect<&OnMeshRendererAdded>();
-		RHI::UVector2D resolution = { (uint32_t)desc.Resolution.x, (uint32_t)desc.Resolution.y };
-		sceneResolution[0] = resolution.x;
-		sceneResolution[1] = resolution.y;
-		clustersDim[0] = desc.clusterX;
-		clustersDim[1] = desc.clusterY;
-		clustersDim[2] = desc.clusterZ;
-
-		uint32_t numClusters = desc.clusterX * desc.clusterY * desc.clusterZ;
-		uint32_t clusterBufferSize = clusterAABBsize * numClusters;
-
-		clusterAABB.CreateStack(nullptr, clusterBufferSize);
-		sparseActiveClustersBuffer_lightIndices.CreateStack(nullptr, sizeof(uint32_t) * numClusters * 50);//assuming a cluster can have 50 lights
-		activeClustersBuffer.CreateStack(nullptr, numClusters * sizeof(uint32_t));
-		lightListSize = ((sizeof(float) * 4) * 100);
-		lightList.CreateStack(nullptr, lightListSize, SBCreateFlags::AllowCPUAccess);
-		lightGrid.CreateStack(nullptr, numClusters * sizeof(uint32_t) * 4);
-		zPrepass.CreateStack(resolution.x, resolution.y, 1, RHI::Format::D32_FLOAT PT_DEBUG_REGION(, "Scene -> ZPrepass"));
-		finalRender.CreateStack(resolution.x, resolution.y, 1, RHI::Format::R16G16B16A16_FLOAT PT_DEBUG_REGION(, "Scene -> Final Render"));
-		shadowMarker.CreateStack(nullptr, sizeof(uint32_t));
-		shadowMapAtlas.CreateStack(4096, 4096,1, RHI::Format::D32_FLOAT PT_DEBUG_REGION(, "Scene -> Shadow Map"));
-		computeShaderMiscBuffer.CreateStack(nullptr, sizeof(uint32_t) * 2, SBCreateFlags::None);
-		
-		ComputeShader* shd_buildClusters = Renderer::GetBuiltinComputeShader("Build Clusters");
-		ComputeShader* shd_activeClusters = Renderer::GetBuiltinComputeShader("Filter Clusters");
-		ComputeShader* shd_tightenList = Renderer::GetBuiltinComputeShader("Tighten Clusters");
-		ComputeShader* shd_cullLights = Renderer::GetBuiltinComputeShader("Cull Lights");
-		Shader* shd_prepass = Renderer::GetBuiltinShader("Z-Prepass");
-		const Shader* shd_fwd = &assetMan->GetResource<ShaderAsset>(*assetMan->GetAsset("Default Shader"))->GetShader();
-		Shader* shd_Shadow = Renderer::GetBuiltinShader("Shadow Shader");
-		Shader* shd_background = Renderer::GetBuiltinShader("Background Shader");
-		for (uint32_t i = 0; i < RendererBase::numFramesInFlight; i++)
-		{
-			passCB[i].CreateStack(nullptr, sizeof(PassConstants));
-			shd_buildClusters->GetShaderBinding(passCBinfoCMP[i], 1);
-			shd_prepass->GetShaderBinding(passCBinfoGFX[i], 1);
-			shd_fwd->GetShaderBinding(passCBinfoVS_PS[i], 1);
-
-			BufferBindingUpdateDesc bbud;
-			bbud.buffer = passCB[i].GetID();
-			bbud.size = sizeof(PassConstants);
-			bbud.type = RHI::DescriptorType::ConstantBuffer;
-			bbud.offset = 0;
-			passCBinfoCMP[i].UpdateBufferBinding(bbud, 0);
-			passCBinfoGFX[i].UpdateBufferBinding(bbud, 0);
-			passCBinfoVS_PS[i].UpdateBufferBinding(bbud, 0);
-			
-		}
-		shd_fwd->GetShaderBinding(sceneInfo, 2);
-		sceneInfo.UpdateTextureBinding(Renderer::GetBrdfTexture().GetView(), 0);
-		sceneInfo.UpdateTextureBinding(Renderer::GetDefaultCubeMap().GetView(), 1);
-		sceneInfo.UpdateTextureBinding(Renderer::GetDefaultCubeMap().GetView(), 2);
-		sceneInfo.UpdateTextureBinding(shadowMapAtlas.GetView(), 3);
-
-		sceneInfo.UpdateBufferBinding(lightGrid.GetID(), 0, numClusters * sizeof(uint32_t) * 4, RHI::DescriptorType::StructuredBuffer, 4);
-		sceneInfo.UpdateBufferBinding(lightList.GetID(), 0, lightListSize, RHI::DescriptorType::StructuredBuffer, 5);
-		sceneInfo.UpdateBufferBinding(sparseActiveClustersBuffer_lightIndices.GetID(), 0, sizeof(uint32_t) * numClusters * 50, RHI::DescriptorType::StructuredBuffer, 6);
-
-		sceneInfo.UpdateSamplerBinding(Renderer::GetDefaultSampler(), 7);
-		sceneInfo.UpdateSamplerBinding(Renderer::GetDefaultSampler(), 8);
-		sceneInfo.UpdateSamplerBinding(Renderer::GetShadowSampler(), 9);
-
-		shd_background->GetShaderBinding(backgroundInfo, 1);
-		backgroundInfo.UpdateTextureBinding(Renderer::GetDefaultCubeMap().GetView(), 0);
-		backgroundInfo.UpdateSamplerBinding(Renderer::GetDefaultSampler(), 1);
-
-		shd_Shadow->GetShaderBinding(shadowSetInfo, 1);
-		shadowSetInfo.UpdateBufferBinding(lightList.GetID(), 0, lightListSize, RHI::DescriptorType::StructuredBuffer, 0);
-
-		shd_buildClusters->GetShaderBinding(buildClusterInfo, 0);
-		buildClusterInfo.UpdateBufferBinding(clusterAABB.GetID(), 0, clusterBufferSize, RHI::DescriptorType::CSBuffer, 0);
-		shd_activeClusters->GetShaderBinding(activeClusterInfo, 0);
-		activeClusterInfo.UpdateTextureBinding(zPrepass.GetView(), 0);
-		activeClusterInfo.UpdateBufferBinding(sparseActiveClustersBuffer_lightIndices.GetID(), 0, sizeof(uint32_t) * numClusters, RHI::DescriptorType::CSBuffer, 1);
-		shd_tightenList->GetShaderBinding(tightenListInfo, 0);
-		tightenListInfo.UpdateBufferBinding(sparseActiveClustersBuffer_lightIndices.GetID(), 0, sizeof(uint32_t) * numClusters, RHI::DescriptorType::StructuredBuffer, 0);
-		tightenListInfo.UpdateBufferBinding(computeShaderMiscBuffer.GetID(), 0, sizeof(uint32_t), RHI::DescriptorType::CSBuffer, 1);
-		tightenListInfo.UpdateBufferBinding(activeClustersBuffer.GetID(), 0, sizeof(uint32_t) * numClusters, RHI::DescriptorType::CSBuffer, 2);
-		shd_cullLights->GetShaderBinding(cullLightsInfo, 0);
-		cullLightsInfo.UpdateBufferBinding(clusterAABB.GetID(), 0, clusterAABBsize, RHI::DescriptorType::StructuredBuffer, 0);
-		cullLightsInfo.UpdateBufferBinding(activeClustersBuffer.GetID(), 0, sizeof(uint32_t) * numClusters, RHI::DescriptorType::StructuredBuffer, 1);
-		cullLightsInfo.UpdateBufferBinding(lightList.GetID(), 0, lightListSize, RHI::DescriptorType::StructuredBuffer, 2);
-		cullLightsInfo.UpdateBufferBinding(computeShaderMiscBuffer.GetID(), 0, sizeof(uint32_t)*2, RHI::DescriptorType::CSBuffer, 3);
-		cullLightsInfo.UpdateBufferBinding(sparseActiveClustersBuffer_lightIndices.GetID(), 0, sizeof(uint32_t) * numClusters * 50, RHI::DescriptorType::CSBuffer, 4);
-		cullLightsInfo.UpdateBufferBinding(lightGrid.GetID(), 0, numClusters * sizeof(uint32_t) * 4, RHI::DescriptorType::CSBuffer, 5);
-
-		RGTextureHandle depthTex = graph.CreateTexture(&zPrepass);
-		finalRenderTex = graph.CreateTexture(&finalRender);
-		RGTextureHandle shadowMap = graph.CreateTexture(&shadowMapAtlas);
-		RGBufferHandle clustersBuffer = graph.CreateBuffer(clusterAABB.GetID(), 0, clusterBufferSize);
-		RGBufferHandle sparseActiveClusterBuffer = graph.CreateBuffer(sparseActiveClustersBuffer_lightIndices.GetID(), 0, sizeof(uint32_t) * numClusters * 50);
-		RGBufferHandle ActiveClusterBuffer = graph.CreateBuffer(activeClustersBuffer.GetID(), 0, numClusters * sizeof(uint32_t));
-		RGBufferInstance LightIndices = graph.MakeUniqueInstance(sparseActiveClusterBuffer);//we alias the sparse buffer
-		RGBufferHandle LightList = graph.CreateBuffer(lightList.GetID(), 0, lightListSize);//light list is transient as it switches queue families
-		RGBufferHandle LightGrid = graph.CreateBuffer(lightGrid.GetID(), 0, numClusters * 4 * sizeof(uint32_t));
-		RGTextureInstance finalRenderWithBackground = graph.MakeUniqueInstance(finalRenderTex);
-
-		AttachmentInfo a_info;
-		BufferAttachmentInfo b_info;
-		Matrix4 view = Matrix4::CreateLookAt({ 0,3,-10 }, { 0,0,0 }, { 0,1,0 });;
-		Matrix4 proj = Matrix4::CreatePerspectiveFieldOfView(Math::ToRadians(45.f), 16.f / 9.f, 0.1, 50.f);
-		PassConstants pc;
-		XMStoreFloat4x4(&pc.View, XMMatrixTranspose(view));
-		XMStoreFloat4x4(&pc.Proj, XMMatrixTranspose(proj));
-		XMStoreFloat4x4(&pc.ViewProj, XMMatrixMultiplyTranspose(view, proj));
-		XMStoreFloat4x4(&pc.InvProj, XMMatrixTranspose(XMMatrixInverse(nullptr, proj)));
-		XMStoreFloat4x4(&pc.InvView, XMMatrixTranspose(XMMatrixInverse(nullptr, view)));
-		XMStoreFloat4x4(&pc.InvViewProj, XMMatrixTranspose(XMMatrixInverse(nullptr, view * proj)));
-		pc.numClusters = { 16,9,24 };
-		pc.RenderTargetSize = { 1920,1080 };
-		pc.NearZ = 0.1f;
-		pc.FarZ = 50.f;
-		pc.InvRenderTargetSize = { 1.f / 1920.f, 1.f / 1080.f };
-		pc.bias = (24.f * log10f(0.1f)) / (log10f(50.f / 0.1f));
-		pc.scale = 24.f / (log10f(50.f / 0.1f));
-		pc.numClusters = { 16,9,24 };
-		pc.numDirectionalRegularLights = 0;
-		pc.numDirectionalShadowLights = 0;
-		pc.numRegularLights = 0;
-		pc.numShadowLights = 0;
-		pc.EyePosW = { 0,3,-10 };
-		for (uint32_t i = 0; i < 3; i++)
-		{
-			passCB[i].Update(&pc, sizeof(PassConstants), 0);
-		}
-
-		RenderPass& zprepass = graph.AddPass(RHI::PipelineStage::LATE_FRAGMENT_TESTS_BIT, "Z-Prepass");
-		{
-			a_info.format = RHI::Format::D32_FLOAT;//?
-			a_info.access = AttachmentAccess::Write;
-			a_info.usage = AttachmentUsage::Graphics;
-			a_info.texture = depthTex;
-			zprepass.SetDepthStencilOutput(&a_info);
-			zprepass.SetPassArea({ {0,0}, resolution });
-			zprepass.SetShader(shd_prepass);
-			zprepass.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list) 
-				{
-					RHI::Viewport vp;
-					vp.height = sceneResolution[1];
-					vp.width = sceneResolution[0];
-					vp.minDepth = 0;
-					vp.maxDepth = 1;
-					vp.x = vp.y = 0;
-					list->SetViewports(1, &vp);
-					RHI::Area2D rect = { {0,0},{sceneResolution[0],sceneResolution[1]}};
-					list->SetScissorRects(1, &rect);
-					Shader* shd = Renderer::GetBuiltinShader("Z-Prepass");
-					list->SetRootSignature(shd->GetRootSignature());
-					shd->ApplyBinding(list, passCBinfoGFX[RendererBase::GetCurrentFrameIndex()]);
-					AssetManager* assetMan = GetAssetManager();
-					list->BindVertexBuffers(0, 1, &Renderer::GetVertexBuffer()->ID);
-					list->BindIndexBuffer(Renderer::GetIndexBuffer(), 0);
-					for (auto entity : meshesToDraw)
-					{
-						auto& meshc = m_Registry.get<MeshRendererComponent>(entity);
-						const Model* model = assetMan->GetResource<Model>(meshc.Model);
-						const Mesh& mesh = model->meshes[meshc.modelIndex];
-						list->BindDynamicDescriptor(Renderer::GetCBDesc(), 0, Renderer::GetCBOffset(meshc.handle));
-						Renderer::Submit(list, mesh.GetVBHandle(), mesh.GetIBHandle(), sizeof(Vertex));
-					}
-				};
-		}
-		RenderPass& dirShadow = graph.AddPass(RHI::PipelineStage::LATE_FRAGMENT_TESTS_BIT, "Directional Shadow");
-		{
-			a_info.format = RHI::Format::D32_FLOAT;//?
-			a_info.access = AttachmentAccess::ReadWrite;
-			a_info.usage = AttachmentUsage::Unspec;
-			a_info.texture = shadowMap;
-			b_info.buffer = LightList;
-			b_info.usage = AttachmentUsage::Graphics;
-			dirShadow.SetDepthStencilOutput(&a_info);
-			dirShadow.AddBufferOutput(&b_info);
-			dirShadow.SetPassArea({ {0,0}, {shadowMapAtlas.GetWidth(), shadowMapAtlas.GetHeight()} });
-			dirShadow.SetShader(shd_Shadow);
-			dirShadow.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list) 
-				{
-					RHI::RenderingAttachmentDesc attachDesc{};
-					attachDesc.clearColor = { 1,1,1,1 };
-					attachDesc.ImageView = RendererBase::GetCPUHandle(shadowMapAtlas.DSView.Get());
-					attachDesc.loadOp = RHI::LoadOp::Clear;
-					attachDesc.storeOp = RHI::StoreOp::Store;
-					RHI::RenderingBeginDesc rbDesc{};
-					rbDesc.pDepthStencilAttachment = &attachDesc;
-
-					AssetManager* assetMan = GetAssetManager();
-					uint32_t baseOffset = (regularLights.size() * sizeof(RegularLight)) / (sizeof(float) * 4);
-					uint32_t offsetMul = sizeof(ShadowCastingLight) / (sizeof(float) * 4);
-					uint32_t index = 0;
-					Shader* shd = Renderer::GetBuiltinShader("Shadow Shader");
-					for (auto& light : shadowLights)
-					{
-						if ((light.light.type != LightType::Directional)) 
-						{ index++; continue; }
-
-						RHI::Viewport vp[4];
-						vp[0].height = light.shadowMap.size.y/2; vp[0].width = light.shadowMap.size.x/2;
-						vp[0].minDepth = 0; vp[0].maxDepth = 1;
-						vp[0].x = light.shadowMap.offset.x; vp[0].y = light.shadowMap.offset.y;
-						vp[1] = vp[2] = vp[3] = vp[0];
-
-						vp[1].x += vp[1].width; vp[2].y += vp[2].height; vp[3].y += vp[3].height; vp[3].x += vp[3].width;
-
-						RHI::Area2D rect = { {(int)vp[0].x,(int)vp[0].y},{(uint32_t)vp[0].width*2, (uint32_t)vp[0].height*2 }};
-						
-						shd->ApplyBinding(list, shadowSetInfo);
-						list->SetScissorRects(1, &rect);
-						auto meshes = m_Registry.view<MeshRendererComponent>();
-						rbDesc.renderingArea = { {(int)light.shadowMap.offset.x,(int)light.shadowMap.offset.y},
-							{light.shadowMap.size.x, light.shadowMap.size.y} };
-						list->BeginRendering(rbDesc);
-						uint32_t offset_cascade[2] = {baseOffset + (index * offsetMul),0};
-						for (auto entity : meshes)
-						{
-							auto& meshc = meshes.get<MeshRendererComponent>(entity);
-							const Model* model = assetMan->GetResource<Model>(meshc.Model);
-							if(!model) continue;
-							const Mesh& mesh = model->meshes[meshc.modelIndex];
-							list->BindDynamicDescriptor(Renderer::GetCBDesc(), 0, Renderer::GetCBOffset(meshc.handle));
-							for(uint32_t i = 0; i < 4; i++)
-							{
-								list->SetViewports(1, &vp[i]);
-								offset_cascade[1] = i;
-								list->PushConstants(1,2,offset_cascade,0);
-								Renderer::Submit(list, mesh.GetVBHandle(), mesh.GetIBHandle(), sizeof(Vertex));
-							}
-						}
-						list->EndRendering();
-						index++;
-					}
-				};
-		}
-		RenderPass& pntShadow = graph.AddPass(RHI::PipelineStage::LATE_FRAGMENT_TESTS_BIT, "Point Shadow");
-		{
-			a_info.format = RHI::Format::D32_FLOAT;//?
-			a_info.access = AttachmentAccess::ReadWrite;//dont clear the shadow map
-			a_info.usage = AttachmentUsage::Graphics;
-			a_info.texture = shadowMap;
-			pntShadow.SetDepthStencilOutput(&a_info);
-			pntShadow.SetPassArea({ {0,0}, {shadowMapAtlas.GetWidth(), shadowMapAtlas.GetHeight()} });;
-			//sptShadow.SetShader(nullptr);
-			pntShadow.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list) {
-				};
-		}
-		RenderPass& sptShadow = graph.AddPass(RHI::PipelineStage::ALL_GRAPHICS_BIT, "Spot Shadow");
-		{
-			a_info.format = RHI::Format::D32_FLOAT;//?
-			a_info.access = AttachmentAccess::Write;
-			a_info.usage = AttachmentUsage::Unspec;
-			a_info.texture = shadowMap;
-			b_info.buffer = LightList;
-			b_info.usage = AttachmentUsage::Graphics;
-			sptShadow.SetDepthStencilOutput(&a_info);
-			sptShadow.AddBufferOutput(&b_info);
-			sptShadow.SetShader(shd_Shadow);
-			sptShadow.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
-				{
-					RHI::RenderingAttachmentDesc attachDesc{};
-					attachDesc.clearColor = { 1,1,1,1 };
-					attachDesc.ImageView = RendererBase::GetCPUHandle(shadowMapAtlas.DSView.Get());
-					attachDesc.loadOp = RHI::LoadOp::Clear;
-					attachDesc.storeOp = RHI::StoreOp::Store;
-					RHI::RenderingBeginDesc rbDesc{};
-					rbDesc.pDepthStencilAttachment = &attachDesc;
-
-					AssetManager* assetMan = GetAssetManager();
-					uint32_t baseOffset = (regularLights.size() * sizeof(RegularLight)) / (sizeof(float) * 4);
-					uint32_t offsetMul = sizeof(ShadowCastingLight) / (sizeof(float) * 4);
-					uint32_t index = 0;
-					Shader* shd = Renderer::GetBuiltinShader("Shadow Shader");
-					for (auto& light : shadowLights)
-					{
-						if ((light.light.type != LightType::Spot)) 
-						{ index++; continue; }
-						RHI::Viewport vp;
-						vp.height = light.shadowMap.size.y; vp.width = light.shadowMap.size.x;
-						vp.minDepth = 0; vp.maxDepth = 1;
-						vp.x = light.shadowMap.offset.x; vp.y = light.shadowMap.offset.y;
-						list->SetViewports(1, &vp);
-						RHI::Area2D rect = { {(int)vp.x,(int)vp.y},{(uint32_t)vp.width, (uint32_t)vp.height }};
-						shd->ApplyBinding(list, shadowSetInfo);
-						list->SetScissorRects(1, &rect);
-						uint32_t offset[2] = {baseOffset + (index * offsetMul),0};
-						list->PushConstants(1,2,offset,0);
-						auto meshes = m_Registry.view<MeshRendererComponent>();
-						rbDesc.renderingArea = { {(int)light.shadowMap.offset.x,(int)light.shadowMap.offset.y},
-							{light.shadowMap.size.x, light.shadowMap.size.y} };
-						list->BeginRendering(rbDesc);
-						for (auto entity : meshes)
-						{
-							auto& meshc = meshes.get<MeshRendererComponent>(entity);
-							const auto* model = assetMan->GetResource<Model>(meshc.Model);
-							const Mesh& mesh = model->meshes[meshc.modelIndex];
-							list->BindDynamicDescriptor(Renderer::GetCBDesc(), 0, Renderer::GetCBOffset(meshc.handle));
-							Renderer::Submit(list, mesh.GetVBHandle(), mesh.GetIBHandle(), sizeof(Vertex));
-						}
-						list->EndRendering();
-						index++;
-					}
-				};
-		}
-		ComputePass& buildClusters = graph.AddComputePass("Build Clusters");
-		{
-			b_info.usage = AttachmentUsage::Compute;
-			b_info.buffer = clustersBuffer;
-			buildClusters.AddBufferOutput(&b_info);
-			buildClusters.SetShader(Renderer::GetBuiltinComputeShader("Build Clusters"));
-			buildClusters.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list) 
-				{
-					ComputeShader* shd = Renderer::GetBuiltinComputeShader("Build Clusters");
-					shd->ApplyShaderBinding(list, passCBinfoCMP[RendererBase::GetCurrentFrameIndex()]);
-					shd->ApplyShaderBinding(list, buildClusterInfo);
-					list->Dispatch(clustersDim[0], clustersDim[1], clustersDim[2]);
-					list->MarkBuffer(graph.dbgBufferCMP, 3);
-				};
-		}
-		ComputePass& filterClusters = graph.AddComputePass("Filter Clusters");
-		{
-			a_info.format = RHI::Format::D32_FLOAT;
-			a_info.access = AttachmentAccess::ReadWrite;
-			a_info.texture = depthTex;
-			a_info.usage = AttachmentUsage::Compute;
-			filterClusters.AddColorInput(&a_info);
-			b_info.usage = AttachmentUsage::Compute;
-			b_info.buffer = sparseActiveClusterBuffer;
-			filterClusters.AddBufferOutput(&b_info);
-			filterClusters.SetShader(Renderer::GetBuiltinComputeShader("Filter Clusters"));
-			filterClusters.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
-				{
-					ComputeShader* shd = Renderer::GetBuiltinComputeShader("Filter Clusters");
-					shd->ApplyShaderBinding(list, passCBinfoCMP[RendererBase::GetCurrentFrameIndex()]);
-					shd->ApplyShaderBinding(list, activeClusterInfo);
-					list->Dispatch(sceneResolution[0], sceneResolution[1], 1);
-					list->MarkBuffer(graph.dbgBufferCMP,4);
-				};
-		}
-		ComputePass& tightenCluster = graph.AddComputePass("Tighten Cluster List");
-		{
-			b_info.buffer = sparseActiveClusterBuffer;
-			b_info.usage = AttachmentUsage::Compute;
-			BufferAttachmentInfo b_info2;
-			b_info2.buffer = ActiveClusterBuffer;
-			b_info2.usage = AttachmentUsage::Compute;
-			tightenCluster.AddBufferInput(&b_info);
-			tightenCluster.AddBufferOutput(&b_info2);
-			tightenCluster.SetShader(Renderer::GetBuiltinComputeShader("Tighten Clusters"));
-			tightenCluster.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
-				{
-					ComputeShader* shd = Renderer::GetBuiltinComputeShader("Tighten Clusters");
-					shd->ApplyShaderBinding(list, passCBinfoCMP[RendererBase::GetCurrentFrameIndex()]);
-					shd->ApplyShaderBinding(list, tightenListInfo);
-					list->Dispatch(clustersDim[0], clustersDim[1], clustersDim[2]);
-					list->MarkBuffer(graph.dbgBufferCMP, 5);
-				};
-		}
-		ComputePass& cullLights = graph.AddComputePass("Light Culling");
-		{
-			b_info.buffer = LightIndices;
-			b_info.usage = AttachmentUsage::Compute;
-			BufferAttachmentInfo b_info2{ LightList, AttachmentUsage::Compute };
-			BufferAttachmentInfo b_info3{ LightGrid, AttachmentUsage::Compute };
-			BufferAttachmentInfo b_info4{ ActiveClusterBuffer, AttachmentUsage::Compute };
-			cullLights.AddBufferInput(&b_info4);
-			cullLights.AddBufferOutput(&b_info);
-			cullLights.AddBufferInput(&b_info2);
-			cullLights.AddBufferOutput(&b_info3);
-			cullLights.SetShader(Renderer::GetBuiltinComputeShader("Cull Lights"));
-			cullLights.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
-				{
-					ComputeShader* shd = Renderer::GetBuiltinComputeShader("Cull Lights");
-					shd->ApplyShaderBinding(list, passCBinfoCMP[RendererBase::GetCurrentFrameIndex()]);
-					shd->ApplyShaderBinding(list, cullLightsInfo);
-					list->Dispatch(clustersDim[0], clustersDim[1], clustersDim[2]);
-					list->MarkBuffer(graph.dbgBufferCMP, 6);
-					list->MarkBuffer(computeShaderMiscBuffer.GetID(), 0, 0);
-					list->MarkBuffer(computeShaderMiscBuffer.GetID(), 4, 0);
-				};
-		}
-		RenderPass& fwdShading = graph.AddPass(RHI::PipelineStage::ALL_GRAPHICS_BIT, "Forward Shading");
-		{
-			b_info.buffer = LightIndices;
-			b_info.usage = AttachmentUsage::Graphics;
-			BufferAttachmentInfo b_info2{ LightList, AttachmentUsage::Graphics };
-			BufferAttachmentInfo b_info3{ LightGrid, AttachmentUsage::Graphics };
-			fwdShading.AddBufferInput(&b_info);
-			fwdShading.AddBufferInput(&b_info2);
-			fwdShading.AddBufferInput(&b_info3);
-			a_info.format = RHI::Format::D32_FLOAT;
-			a_info.texture = shadowMap;
-			a_info.access = AttachmentAccess::Read;
-			a_info.usage = AttachmentUsage::Graphics;
-			fwdShading.AddColorInput(&a_info);
-			a_info.format = RHI::Format::R16G16B16A16_FLOAT;
-			a_info.texture = finalRenderTex;
-			a_info.access = AttachmentAccess::Write;
-			fwdShading.AddColorOutput(&a_info);
-			a_info.format = RHI::Format::D32_FLOAT;
-			a_info.texture = depthTex;
-			a_info.access = AttachmentAccess::Read;
-			a_info.usage = AttachmentUsage::Graphics;
-			fwdShading.SetDepthStencilOutput(&a_info);
-			//fwdShading.SetShader(); we dont set shader because of custom shader support
-			fwdShading.SetPassArea({ { 0,0},resolution });
-			fwdShading.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
-				{
-					RHI::Viewport vp;
-					vp.height = sceneResolution[1];
-					vp.width = sceneResolution[0];
-					vp.minDepth = 0;
-					vp.maxDepth = 1;
-					vp.x = vp.y = 0;
-					list->SetViewports(1, &vp);
-					RHI::Area2D rect = { 0,0,sceneResolution[0],sceneResolution[1] };
-					list->SetScissorRects(1, &rect);
-					AssetManager* assetMan = GetAssetManager();
-					list->BindVertexBuffers(0, 1, &Renderer::GetVertexBuffer()->ID);
-					list->BindIndexBuffer(Renderer::GetIndexBuffer(), 0);
-					
-					for (auto entity : meshesToDraw)
-					{
-						auto& meshc = m_Registry.get<MeshRendererComponent>(entity);
-						const auto* mtl = assetMan->GetResource<Material>(meshc.material);
-						mtl->Bind(list);
-						Renderer::FullCBUpdate(mtl->parametersBuffer, mtl->parametersBufferCPU);
-						const Shader& shd = assetMan->GetResource<ShaderAsset>(mtl->GetShader())->GetShader();
-						const auto* model = assetMan->GetResource<Model>(meshc.Model);
-						const Mesh& mesh = model->meshes[meshc.modelIndex];
-						shd.ApplyBinding(list, passCBinfoVS_PS[RendererBase::GetCurrentFrameIndex()]);
-						shd.ApplyBinding(list, sceneInfo);
-						list->BindDynamicDescriptor(Renderer::GetCBDesc(), 0, Renderer::GetCBOffset(meshc.handle));
-						Renderer::Submit(list, mesh.GetVBHandle(), mesh.GetIBHandle(), sizeof(Vertex));
-					}
-				};
-			
-		}
-		RenderPass& backgroundPass = graph.AddPass(RHI::PipelineStage::ALL_GRAPHICS_BIT, "Background Pass");
-		{
-			a_info.format = RHI::Format::R16G16B16A16_FLOAT;
-			a_info.texture = finalRenderTex;
-			a_info.access = AttachmentAccess::Read;
-			backgroundPass.AddColorInput(&a_info);
-			a_info.texture = finalRenderWithBackground;
-			backgroundPass.AddColorOutput(&a_info);
-			a_info.format = RHI::Format::D32_FLOAT;
-			a_info.texture = depthTex;
-			a_info.access = AttachmentAccess::Read;
-			a_info.usage = AttachmentUsage::Graphics;
-			backgroundPass.SetDepthStencilOutput(&a_info);
-			backgroundPass.SetShader(shd_background);
-			backgroundPass.SetPassArea({ { 0,0},resolution });
-			backgroundPass.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
-			{
-				RHI::Viewport vp;
-				vp.height = sceneResolution[1];
-				vp.width = sceneResolution[0];
-				vp.minDepth = 0;
-				vp.maxDepth = 1;
-				vp.x = vp.y = 0;
-				list->SetViewports(1, &vp);
-				RHI::Area2D rect = { 0,0,sceneResolution[0],sceneResolution[1] };
-				list->SetScissorRects(1, &rect);
-				auto* shader = Renderer::GetBuiltinShader("Background Shader");
-				auto& cb_info = passCBinfoGFX[RendererBase::GetCurrentFrameIndex()];
-				uint32_t old_ind = cb_info.setIndex;
-				cb_info.setIndex = 0;
-				shader->ApplyBinding(list, passCBinfoGFX[RendererBase::GetCurrentFrameIndex()]);
-				cb_info.setIndex = old_ind;
-				shader->ApplyBinding(list, backgroundInfo);
-				Renderer::Submit(list, Renderer::UnitCube()->GetVBHandle(), Renderer::UnitCube()->GetIBHandle(), sizeof(Vertex));
-			};
-		}
-		graph.Compile();
-
-		//graph.Execute();
-		//graph.SubmitToQueue();
-	}
-	Scene::~Scene()
-	{
-	}
-	Entity Scene::CreateRootEntity(UUID ID)
-	{
-		Entity entity = { m_Registry.create(), this };
-		entity.AddComponent<IDComponent>(ID);
-		auto& hierarchy = entity.AddComponent<HierarchyComponent>();
-		hierarchy.parentID = entt::null;
-		entity.AddComponent<TransformComponent>();
-		auto& tag = entity.AddComponent<TagComponent>();
-		tag.Tag = "Root";
-		return entity;
-	}
-	Entity Scene::CreateEntity(const std::string& name)
-	{
-		return CreateEntityWithUUID(UUID(), name);
-	}
-	Entity Scene::DuplicateEntity(Entity entity)
-	{
-		if (entity.GetComponent<HierarchyComponent>().parentID == entt::null)
-			return entity;
-		Entity newEntity = CreateEntity(entity.GetComponent<TagComponent>().Tag + "-Copy");
-		newEntity.GetComponent<TransformComponent>() = entity.GetComponent<TransformComponent>();
-		newEntity.GetComponent<HierarchyComponent>() = entity.GetComponent<HierarchyComponent>();
-		if (entity.HasComponent<LightComponent>()) newEntity.AddComponent<LightComponent>(entity.GetComponent<LightComponent>());
-		if (entity.HasComponent<SpriteRendererComponent>()) newEntity.AddComponent<SpriteRendererComponent>() = entity.GetComponent<SpriteRendererComponent>();
-		if (entity.HasComponent<MeshRendererComponent>()) newEntity.AddComponent<MeshRendererComponent>() = entity.GetComponent<MeshRendererComponent>();
-		if (entity.HasComponent<RigidBodyComponent>()) newEntity.AddComponent<RigidBodyComponent>() = entity.GetComponent<RigidBodyComponent>();
-		if (entity.HasComponent<BoxColliderComponent>()) newEntity.AddComponent<BoxColliderComponent>() = entity.GetComponent<BoxColliderComponent>();
-		if (entity.HasComponent<SphereColliderComponent>()) newEntity.AddComponent<SphereColliderComponent>() = entity.GetComponent<SphereColliderComponent>();
-		return newEntity;
-	}
-	void Scene::ReparentEntity(Entity e, Entity new_parent)
-	{
-		if(e == root) return;
-		auto view = m_Registry.view<HierarchyComponent>();
-		auto& child = view.get<HierarchyComponent>(e);
-		auto& old_tree = view.get<HierarchyComponent>(child.parentID);
-		auto& new_tree = view.get<HierarchyComponent>(new_parent);
-		//if new parent is a child of e return
-		entt::entity iter = new_tree.parentID;
-		while(iter != entt::null)
-		{
-			if(iter == e) return;
-			iter = view.get<HierarchyComponent>(iter).parentID;
-		}
-		auto it = std::find(old_tree.chilren.begin(), old_tree.chilren.end(), e);
-		old_tree.chilren.erase(it);
-
-		child.parentID = new_parent;
-		new_tree.chilren.push_back(e);
-	}
-
-	void Scene::SyncSkybox()
-	{
-		auto& env = m_Registry.get<EnvironmentComponent>(root);
-		auto skybox = GetAssetManager()->GetResource<Skybox>(env.skybox);
-		sceneInfo.UpdateTextureBinding(skybox->Irradiance()->GetView(), 1);
-		sceneInfo.UpdateTextureBinding(skybox->SpecularPrefiltered()->GetView(), 2);
-
-		backgroundInfo.UpdateTextureBinding(skybox->Base()->GetView(), 0);
-	}
-
-	Entity Scene::CreateEntityWithUUID(UUID ID, const std::string& name)
-	{
-		Entity entity = { m_Registry.create(), this };
-		entity.AddComponent<IDComponent>(ID);
-		entity.AddComponent<HierarchyComponent>((entt::entity)0);
-		entity.AddComponent<TransformComponent>();
-		auto& tag = entity.AddComponent<TagComponent>();
-		char id[100] = {'E','n','t','i','t', 'y', '0', '0', '0', '\0'};
-		sprintf(id+6,"%u",((uint32_t)entity));
-		tag.Tag = name.empty() ? id : name;
-
-		auto& root_children = m_Registry.get<HierarchyComponent>(root);
-		root_children.chilren.push_back(entity);
-		return entity;
-	}
-	void Scene::OnRuntimeStop()
-	{
-	}
-	void Scene::DestroyEntity(Entity entity)
-	{
-		auto view = m_Registry.view<HierarchyComponent>();
-		for (auto child : view)
-		{
-			if (view.get<HierarchyComponent>(child).parentID == entity)
-				DestroyEntity(Entity(child, this));
-		}
-		m_Registry.destroy(entity);
-	}
-	void Scene::DefferedDelete(Entity entity)
-	{
-		auto view = m_Registry.view<HierarchyComponent>();
-		for (auto child : view)
-		{
-			if (view.get<HierarchyComponent>(child).parentID == entity)
-				DefferedDelete(Entity(child, this));
-		}
-		deletionQueue.push_back(entity);
-	}
-	Entity Scene::GetRootEntity()
-	{
-		return Entity(root, this);
-	}
-	
-	Entity Scene::GetPrimaryCameraEntity()
-	{
-		PT_PROFILE_FUNCTION();
-		auto view = m_Registry.view<CameraComponent>();
-		for (auto entity : view)
-		{
-			const auto& camera = view.get<CameraComponent>(entity);
-			if (camera.Primary)
-				return Entity(entity, this);
-		}
-		return Entity();
-	}
-	Entity Scene::GetEntityByUUID(UUID id)
-	{
-		auto view = m_Registry.view<IDComponent>();
-		Entity retVal = Entity(entt::null, this);
-		for(auto entity : view)
-		{
-			auto [in_id] = view.get(entity);
-			if(in_id.uuid == id)
-			{
-				retVal = Entity(entity, this);
-				break;
-			}
-		}
-		return retVal;
-	}
-	Entity Scene::GetEntityByName(const std::string& name)
-	{
-		auto view = m_Registry.view<TagComponent>();
-		Entity retVal = Entity(entt::null, this);
-		for(auto entity : view)
-		{
-			auto [tag] = view.get(entity);
-			if(tag.Tag == name)
-			{
-				retVal = Entity(entity, this);
-				break;
-			}
-		}
-		return retVal;
-	}
-	std::vector<Entity> Scene::GetAllEntitesWithName(const std::string& name)
-	{
-		auto view = m_Registry.view<TagComponent>();
-		std::vector<Entity> retVal;
-		for(auto entity : view)
-		{
-			auto [tag] = view.get(entity);
-			if(tag.Tag == name) retVal.push_back(Entity(entity, this));
-		}
-		return retVal;
-	}
-	void Scene::UpdatePassConstants(const Matrix4& view, const SceneCamera& cam, const Vector3& camPos,float delta)
-	{
-		const Matrix4& proj = cam.GetProjection();
-		Matrix4 viewProj = view * proj;
-		XMStoreFloat4x4(&passConstants.View, XMMatrixTranspose(view));
-		XMStoreFloat4x4(&passConstants.Proj, XMMatrixTranspose(proj));
-		XMStoreFloat4x4(&passConstants.ViewProj, XMMatrixTranspose(viewProj));
-		XMStoreFloat4x4(&passConstants.InvProj, XMMatrixTranspose(XMMatrixInverse(nullptr, proj)));
-		XMStoreFloat4x4(&passConstants.InvView, XMMatrixTranspose(XMMatrixInverse(nullptr, view)));
-		XMStoreFloat4x4(&passConstants.InvViewProj, XMMatrixTranspose(XMMatrixInverse(nullptr, viewProj)));
-		passConstants.numClusters = { (float)clustersDim[0],(float)clustersDim[1],(float)clustersDim[2]};
-		passConstants.RenderTargetSize = { (float)sceneResolution[0],(float)sceneResolution[1]};
-		passConstants.NearZ = cam.GetNear();
-		passConstants.FarZ = cam.GetFar();
-		passConstants.InvRenderTargetSize = { 1.f / (float)sceneResolution[0], 1.f / (float)sceneResolution[1]};
-		passConstants.bias = ((float)clustersDim[2] * log10f(passConstants.NearZ)) / (log10f(passConstants.FarZ / passConstants.NearZ));
-		passConstants.scale = (float)clustersDim[2] / (log10f(passConstants.FarZ / passConstants.NearZ));
-		passConstants.numDirectionalRegularLights = numRegularDirLights;
-		passConstants.numDirectionalShadowLights = numShadowDirLights;
-		passConstants.numRegularLights = regularLights.size();
-		passConstants.numShadowLights = shadowLights.size();
-		passConstants.EyePosW = camPos;
-		passConstants.DeltaTime = delta;
-		passCB[RendererBase::GetCurrentFrameIndex()].Update(&passConstants, sizeof(PassConstants), 0);
-	}
-	void Scene::UpdatePassConstants(const EditorCamera& cam, float delta)
-	{
-		const Matrix4& proj = cam.GetProjection();
-		const Matrix4& view = cam.GetViewMatrix();
-		Matrix4 viewProj = cam.GetViewProjection();
-		XMStoreFloat4x4(&passConstants.View, XMMatrixTranspose(view));
-		XMStoreFloat4x4(&passConstants.Proj, XMMatrixTranspose(proj));
-		XMStoreFloat4x4(&passConstants.ViewProj, XMMatrixTranspose(viewProj));
-		XMStoreFloat4x4(&passConstants.InvProj, XMMatrixTranspose(XMMatrixInverse(nullptr, proj)));
-		XMStoreFloat4x4(&passConstants.InvView, XMMatrixTranspose(XMMatrixInverse(nullptr, view)));
-		XMStoreFloat4x4(&passConstants.InvViewProj, XMMatrixTranspose(XMMatrixInverse(nullptr, viewProj)));
-		passConstants.numClusters = { (float)clustersDim[0],(float)clustersDim[1],(float)clustersDim[2] };
-		passConstants.RenderTargetSize = { (float)sceneResolution[0],(float)sceneResolution[1] };
-		passConstants.NearZ = cam.GetNearClip();
-		passConstants.FarZ = cam.GetFarClip();
-		passConstants.InvRenderTargetSize = { 1.f / (float)sceneResolution[0], 1.f / (float)sceneResolution[1] };
-		passConstants.bias = ((float)clustersDim[2] * log10f(passConstants.NearZ)) / (log10f(passConstants.FarZ / passConstants.NearZ));
-		passConstants.scale = (float)clustersDim[2] / (log10f(passConstants.FarZ / passConstants.NearZ));
-		passConstants.numDirectionalRegularLights = numRegularDirLights;
-		passConstants.numDirectionalShadowLights = numShadowDirLights;
-		passConstants.numRegularLights = regularLights.size();
-		passConstants.numShadowLights = shadowLights.size();
-		passConstants.EyePosW = cam.GetPosition();
-		passConstants.DeltaTime = delta;
-		passCB[RendererBase::GetCurrentFrameIndex()].Update(&passConstants, sizeof(PassConstants), 0);
-	}
-	const RenderTexture& Scene::GetFinalRender()
-	{
-		return finalRender;
-	}
-	void Scene::UpdateTransforms(entt::entity e, const Matrix4& mat)
-	{
-		auto& tc = m_Registry.get<TransformComponent>(e);
-		auto& hierc = m_Registry.get<HierarchyComponent>(e);
-		tc.worldSpaceTransform = tc.GetLocalTransform() * ((DirectX::XMMATRIX)mat);
-		for(auto child: hierc.chilren)
-		{
-			UpdateTransforms(child, tc.worldSpaceTransform);
-		}
-	}
-	void Scene::OnUpdateEditor(float delta, EditorCamera& camera)
-	{
-		/*
-		* Todo each parent should store a list of thier children, so we can
-		* traverse a scene from the root entity and dirty/update the world space transfrom for the
-		* remainder of the frame. then after the frame everything is "undirtied"
-		*/
-		PT_PROFILE_FUNCTION();
-		meshesToDraw.clear();
-		shadowLights.clear();
-		regularLights.clear();
-		numShadowDirLights = 0;
-		numRegularDirLights = 0;
-		//auto transform_parent_view = m_Registry.view<TransformComponent, HierarchyComponent>();
-		UpdateTransforms(root, Matrix4::Identity);
-		FrustumCull(camera.GetViewMatrix(), camera.GetProjection(),Math::ToRadians(camera.GetFOVdeg()),camera.GetNearClip(), camera.GetFarClip(), camera.GetAspectRatio());
-		UpdateObjectCBs();
-		UpdatePassConstants(camera, delta);
-		UpdateLightsBuffer();
-		
-		graph.Execute();
-		graph.SubmitToQueue();
-		RHI::SubResourceRange range;
-		range.FirstArraySlice = 0;
-		range.imageAspect = RHI::Aspect::COLOR_BIT;
-		range.IndexOrFirstMipLevel = 0;
-		range.NumArraySlices = 1;
-		range.NumMipLevels = 1;
-		RHI::TextureMemoryBarrier barr[1];
-		barr[0].AccessFlagsBefore = RHI::ResourceAcessFlags::NONE;
-		barr[0].AccessFlagsAfter = RHI::ResourceAcessFlags::NONE;
-		barr[0].newLayout = RHI::ResourceLayout::GENERAL;
-		barr[0].nextQueue = barr[0].previousQueue = RHI::QueueFamily::Ignored;
-		barr[0].oldLayout = RHI::ResourceLayout::COLOR_ATTACHMENT_OPTIMAL;
-		barr[0].texture = finalRender.GetID();
-		barr[0].subresourceRange = range;
-
-		RendererBase::GetMainCommandList()->PipelineBarrier(RHI::PipelineStage::COLOR_ATTACHMENT_OUTPUT_BIT,
-			RHI::PipelineStage::TRANSFER_BIT, {}, {barr,1});
-
-		//notify render graph of layout change
-		finalRenderTex.originVector->at(finalRenderTex.offset).current_layout = RHI::ResourceLayout::GENERAL;
-		m_Registry.destroy(deletionQueue.begin(), deletionQueue.end());
-		deletionQueue.clear();
-	}
-	void Scene::OnUpdateRuntime(float delta)
-	{
-
-	}
-	void Scene::OnViewportResize(unsigned int width, unsigned int height)
-	{
-		PT_PROFILE_FUNCTION();
-		//m_viewportWidth  = width;
-		//m_ViewportHeight = height;
-		auto view = m_Registry.view<CameraComponent>();
-		for (auto entity : view)
-		{
-			auto& camera = view.get<CameraComponent>(entity);
-			if (!camera.FixedAspectRatio)
-			{
-				camera.camera.SetViewportSize(width, height);
-			}
-		}
-	}
-	void Scene::UpdateObjectCBs()
-	{
-		PT_PROFILE_FUNCTION();
-		auto view = m_Registry.view<TransformComponent, MeshRendererComponent>();
-		TransformData td;
-		for (auto entity : view)
-		{
-			auto [transform,mesh] = view.get(entity);
-			DirectX::XMStoreFloat4x4(&td.transform, DirectX::XMMatrixTranspose(transform.worldSpaceTransform));
-			DirectX::XMStoreFloat4x4(&td.normal,DirectX::XMMatrixInverse(nullptr, transform.worldSpaceTransform));
-			Renderer::FullCBUpdate(mesh.handle, &td);
-		}
-	}
-	void Scene::SortMeshComponents()
-	{
-		bool dirtyMats = false;
-		auto view = m_Registry.view<MeshRendererComponent>();
-		for (auto entity : view)
-		{
-			auto& mesh = view.get<MeshRendererComponent>(entity);
-			if (mesh.bMaterialDirty)
-			{
-				mesh.bMaterialDirty = false;
-				dirtyMats = true;
-			}
-		}
-		if (dirtyMats)
-		{
-			PT_CORE_WARN("Actually sorted");
-			m_Registry.sort<MeshRendererComponent>([](const MeshRendererComponent& lhs, const MeshRendererComponent& rhs) {return lhs.material.GetUUID() < rhs.material.GetUUID(); });
-		}
-	}
-	void Scene::UpdateLightsBuffer()
-	{
-		uint32_t requiredSize = sizeof(Light) * regularLights.size() + sizeof(ShadowCastingLight) * shadowLights.size();
-		if (requiredSize <= lightListSize)
-		{
-			std::vector<uint8_t> joinedBuffer(requiredSize);
-			if (regularLights.size()) memcpy(joinedBuffer.data(), regularLights.data(), sizeof(Light) * regularLights.size());
-			if (shadowLights.size()) memcpy(joinedBuffer.data() + sizeof(Light) * regularLights.size(), shadowLights.data(), sizeof(ShadowCastingLight) * shadowLights.size());
-			if (requiredSize) lightList.Update(joinedBuffer.data(), requiredSize, 0);
-			return;
-		}
-		DEBUG_BREAK;
-	}
-	//Pratical Subdivision Scheme, i(index), n(num cascades), lambda(number btw 0 and 1)
-	static float pss(int i, int n, float lambda, float near, float far)
-	{
-    	float uni = ((far-near)/((float)n)) * ((float)i) + near;
-    	float log = near * powf((far/near), ((float)i)/((float)n));
-    
-    	return lambda*uni + (1-lambda)*log;
-	}
-	constexpr const uint32_t shadow_size = 512;
-	void Scene::FrustumCull(const Matrix4& view, const Matrix4& proj, float fovRad, float nearClip, float farClip, float aspect)
-	{
-		auto mesh_transform = m_Registry.view<MeshRendererComponent, TransformComponent>();
-		BoundingFrustum cameraFrustum(proj);
-		cameraFrustum.Transform(cameraFrustum, view.Invert());
-		for (auto entity : mesh_transform)
-		{
-			auto [mesh, transform] = mesh_transform.get(entity);
-			const auto* model = GetAssetManager()->GetResource<Model>(mesh.Model);
-			if (model)
-			{
-				BoundingBox box = model->aabbs[mesh.modelIndex];
-				box.Transform(box, transform.worldSpaceTransform);
-				if (CullingManager::FrustumCull(box, cameraFrustum)) //we passed the test
-				{
-					meshesToDraw.emplace_back(entity);
-				}
-			}
-		}
-
-		auto light_transform = m_Registry.view<LightComponent, TransformComponent>();
-		for (auto& entity : light_transform)
-		{
-			auto [lightcomponent,tc] = light_transform.get(entity);
-			//free space in the shadow map from non visible lights
-			if (lightcomponent.Type == LightType::Point || lightcomponent.Type == LightType::Spot)
-			{
-				bool visible = CullingManager::FrustumCull(BoundingSphere(tc.Translation, lightcomponent.exData.z), cameraFrustum);
-				if (!visible)
-				{
-					if (lightcomponent.shadowMap)
-					{
-						sm_allocator.DeAllocate(lightcomponent.shadowMap);
-						lightcomponent.shadowMap = 0;
-					}
-					continue;
-				}
-			}
-			Light light;
-			light.position = tc.Translation;
-			light.type = lightcomponent.Type;
-			float z = 1.f;
-			if (light.type == LightType::Directional) z = -1.f;
-			DirectX::XMVECTOR lightTransform = DirectX::XMVector3Rotate(DirectX::XMVectorSet(0.f, 0.f, z, 1.f), tc.Rotation);
-			DirectX::XMStoreFloat4(&light.rotation, lightTransform);
-			light.exData = { lightcomponent.exData.x , lightcomponent.exData.y, lightcomponent.exData.z, (float)lightcomponent.shadow };
-			light.color = { lightcomponent.color.x, lightcomponent.color.y, lightcomponent.color.z };
-			light.intensity = lightcomponent.Intensity;
-			if (lightcomponent.shadow)
-			{
-				iVector2 allocation_size;
-				ShadowCastingLight* sclight = 0;
-				if (lightcomponent.Type == LightType::Directional)
-				{
-					sclight = &*shadowLights.insert(shadowLights.begin(),ShadowCastingLight());
-					sclight->light = light;
-					numShadowDirLights++;
-					allocation_size = { shadow_size * 4, shadow_size * 4 };
-					float pss_vals[3];
-					for(uint32_t i = 0; i < 3; i++) pss_vals[i] = pss(i+1,4,0.3,nearClip,farClip);
-					/*
-						Massive Hack, But for a directional light, the translation doesn't matter, so we store the cascade plane distances there
-					*/
-					sclight->light.position = Vector3(pss_vals);
-					DirectX::XMStoreFloat4x4(&sclight->projection[0],GetLightMatrixFromCamera(view, DirectX::XMMatrixPerspectiveFovLH(fovRad, aspect, nearClip, pss_vals[0]), light, 1.05f));
-					DirectX::XMStoreFloat4x4(&sclight->projection[1],GetLightMatrixFromCamera(view, DirectX::XMMatrixPerspectiveFovLH(fovRad, aspect, pss_vals[0], pss_vals[1]), light, 1.2f));
-					DirectX::XMStoreFloat4x4(&sclight->projection[2],GetLightMatrixFromCamera(view, DirectX::XMMatrixPerspectiveFovLH(fovRad, aspect, pss_vals[1], pss_vals[2]), light, 1.2f));
-					DirectX::XMStoreFloat4x4(&sclight->projection[3],GetLightMatrixFromCamera(view, DirectX::XMMatrixPerspectiveFovLH(fovRad, aspect, pss_vals[2], farClip), light, 1.2f));
-				}
-				else if (lightcomponent.Type == LightType::Spot)
-				{
-					sclight = &shadowLights.emplace_back();
-					sclight->light = light;
-					allocation_size = { shadow_size, shadow_size };
-					DirectX::XMStoreFloat4x4(&sclight->projection[0],DirectX::XMMatrixTranspose(DirectX::XMMatrixLookAtLH(tc.Translation, DirectX::XMVectorAdd(tc.Translation, DirectX::XMLoadFloat4(&light.rotation)), DirectX::XMVectorSet(0, 1, 0, 0)) * DirectX::XMMatrixPerspectiveFovLH(DirectX::XMScalarACos(lightcomponent.exData.x) * 2, 1, 0.1f, lightcomponent.exData.z)));
-				}
-				else if (lightcomponent.Type == LightType::Point)
-				{
-					sclight = &shadowLights.emplace_back();
-					sclight->light = light;
-					allocation_size = { 256 * 3, 256 * 2 };
-					//todo : Handle point light matrices;
-				}
-				
-				if (lightcomponent.shadowMap != 0) // if there was a shadow map dont allocate a new one unnecessarily
-				{
-					//todo camera cascades for varying shadow map sizes at different distance levels
-					sclight->shadowMap = sm_allocator.GetRegion(lightcomponent.shadowMap);
-				}
-				else
-				{
-					lightcomponent.shadowMap = sm_allocator.Allocate(allocation_size, AllocatorFlags::None); // todo render settings to control allocation size
-					sclight->shadowMap = sm_allocator.GetRegion(lightcomponent.shadowMap);
-				}
-			}
-			else
-			{
-				if (lightcomponent.shadowMap != 0)
-				{
-					sm_allocator.DeAllocate(lightcomponent.shadowMap);
-					lightcomponent.shadowMap = 0;
-				}
-				regularLights.push_back(light);
-			}
-		}
-	}
-
-
+#include "CommandList.h"
+#include "DirectXMath.h"
+#include "FormatsAndTypes.h"
+#include "Pistachio/Debug/Instrumentor.h"
+#include "Pistachio/Renderer/BufferHandles.h"
+#include "Pistachio/Renderer/Mesh.h"
+#include "Pistachio/Renderer/RenderGraph.h"
+#include "Pistachio/Renderer/Renderer.h"
+#include "Pistachio/Renderer/LightListLayout.h"
+#include "Pistachio/Renderer/RendererBase.h"
+#include "Pistachio/Renderer/RendererContext.h"
+#include "ptpch.h"
+#include "Pistachio/Core/Math.h"
+#include "Pistachio/Core/Application.h"
+#include "Pistachio/Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include "Scene.h"
+#include "Components.h"
+#include "LightBounds.h"
+#include "Pistachio/Renderer/Renderer2D.h"
+
+#include "Entity.h"
+#ifdef IMGUI
+#include "imgui.h"
+#include "ImGuizmo.h"
+
+#endif // IMGUI
+
+#include <Pistachio/Renderer/Skybox.h>
+
+#include "ScriptableComponent.h"
+#include "Pistachio/Physics/Physics.h"
+#include "Pistachio/Renderer/MeshFactory.h"
+#include "../Renderer/Material.h"
+
+static void getFrustumCornersWorldSpace(const DirectX::XMMATRIX& proj, const DirectX::XMMATRIX& view, DirectX::XMVECTOR* corners)
+{
+	PT_PROFILE_FUNCTION();
+	const auto inv = DirectX::XMMatrixInverse(nullptr, view * proj);
+	int index = 0;
+	for (unsigned int x = 0; x < 2; ++x)
+	{
+		for (unsigned int y = 0; y < 2; ++y)
+		{
+			for (unsigned int z = 0; z < 2; ++z)
+			{
+				auto pt = DirectX::XMVector4Transform(DirectX::XMVectorSet(2.0f * x - 1.0f, 2.0f * y - 1.0f, 2.0f * z - 1.0f, 1.0f), inv);
+				corners[index] = DirectX::XMVectorScale(pt, 1.f/DirectX::XMVectorGetW(pt));
+				index++;
+			}
+		}
+	}
+}
+/*
+* Orthographic light matrix around a slice of the camera frustum that only moves in whole shadow map texels.
+* The slice is bounded by a sphere measured in view space, so its size doesn't change as the camera turns,
+* and the sphere's center is snapped to the texel grid of a light view fixed at the origin.
+* As long as the camera stays within a texel the matrix is bit for bit the same and a cached cascade stays valid.
+*/
+static DirectX::XMMATRIX GetStableLightMatrix(const DirectX::XMMATRIX& camView, const DirectX::XMMATRIX& camProj, const Pistachio::Light& light, float zMult, uint32_t resolution)
+{
+	PT_PROFILE_FUNCTION();
+	DirectX::XMVECTOR corners[8];
+	getFrustumCornersWorldSpace(camProj, DirectX::XMMatrixIdentity(), corners);
+	DirectX::XMVECTOR center = DirectX::XMVectorZero();
+	for (const auto& v : corners)
+	{
+		center = DirectX::XMVectorAdd(v, center);
+	}
+	center = DirectX::XMVectorScale(center, 1.f / 8.f);
+	float radius = 0.f;
+	for (const auto& v : corners)
+		radius = std::max(radius, DirectX::XMVectorGetX(DirectX::XMVector3Length(DirectX::XMVectorSubtract(v, center))));
+	//rounded up so float noise in the corners doesn't change the size from frame to frame
+	radius = std::ceil(radius * 16.f) / 16.f;
+	center = DirectX::XMVector3TransformCoord(center, DirectX::XMMatrixInverse(nullptr, camView));
+
+	DirectX::XMVECTOR direction = DirectX::XMVectorSetW(DirectX::XMLoadFloat4(&light.rotation), 0.f);
+	const auto lightView = DirectX::XMMatrixLookToLH(DirectX::XMVectorZero(), DirectX::XMVectorNegate(direction), DirectX::XMVectorSet(0.0f, 1.0f, 0.0f, 0.f));
+	DirectX::XMFLOAT3 lightCenter;
+	DirectX::XMStoreFloat3(&lightCenter, DirectX::XMVector3TransformCoord(center, lightView));
+	float texel = (radius * 2.f) / (float)resolution;
+	lightCenter.x = std::floor(lightCenter.x / texel) * texel;
+	lightCenter.y = std::floor(lightCenter.y / texel) * texel;
+	lightCenter.z = std::floor(lightCenter.z / texel) * texel;
+	const DirectX::XMMATRIX lightProjection = DirectX::XMMatrixOrthographicOffCenterLH(lightCenter.x - radius, lightCenter.x + radius,
+		lightCenter.y - radius, lightCenter.y + radius, lightCenter.z - radius * zMult, lightCenter.z + radius * zMult);
+	return DirectX::XMMatrixMultiplyTranspose(lightView, lightProjection);
+}
+static const uint32_t clusterAABBsize = ((sizeof(float) * 4) * 2);
+static const uint32_t INITIAL_GPU_SCENE_CAPACITY = 256;
+static const uint32_t INITIAL_INSTANCE_CAPACITY = 1024;
+static const uint32_t INITIAL_CULLED_RECORD_CAPACITY = 1024;
+static const uint32_t INITIAL_LIGHT_INDEX_CAPACITY = 16384;//indices in the clusters' compact light list, grows from the readback
+static const uint32_t MAX_CLUSTER_LIGHTS = 128;//lights one cluster can list, MaxClusterLights in CFCullLights_cs
+static const uint32_t INITIAL_LIGHT_LIST_SIZE = sizeof(Pistachio::Light) * 64;//the light list grows when a frame needs more
+static const uint32_t OCCLUSION_BUFFER_WIDTH = 256;//a multiple of the culler's 32x4 tiles
+static const uint32_t OCCLUSION_BUFFER_HEIGHT = 128;
+static const uint32_t CASCADE_INSTANCE_SHIFT = 30;//single pass cascade instances keep their cascade above the object id, see ShadowCascades_vs
+//layout of the gpu culling pass's constant buffer
+struct GPUCullConstants
+{
+	uint32_t numRecords;
+	uint32_t occlusion;
+	uint32_t padding0[2];
+	DirectX::XMFLOAT4X4 pyramidViewProj;
+	uint32_t pyramidSize[2];
+	uint32_t pyramidMips;
+	uint32_t padding;
+};
+namespace Pistachio {
+	Scene::Scene(SceneDesc desc) : sm_allocator({ 4096, 4096 }, { 256, 256 })
+	{
+		MeshFactory::CreateCube();
+		PT_PROFILE_FUNCTION();
+		using namespace DirectX;
+		AssetManager* assetMan = GetAssetManager();
+		m_Registry.on_construct<IDComponent>().connect<&Scene::OnIDAdded>(*this);
+		m_Registry.on_update<IDComponent>().connect<&Scene::OnIDUpdated>(*this);
+		m_Registry.on_destroy<IDComponent>().connect<&Scene::OnIDRemoved>(*this);
+		m_Registry.on_construct<TagComponent>().connect<&Scene::OnTagAdded>(*this);
+		m_Registry.on_update<TagComponent>().connect<&Scene::OnTagUpdated>(*this);
+		m_Registry.on_destroy<TagComponent>().connect<&Scene::OnTagRemoved>(*this);
+		m_Registry.on_construct<CameraComponent>().connect<&Scene::OnCameraChanged>(*this);
+		m_Registry.on_update<CameraComponent>().connect<&Scene::OnCameraChanged>(*this);
+		m_Registry.on_destroy<CameraComponent>().connect<&Scene::OnCameraChanged>(*this);
+		m_Registry.on_construct<TransformComponent>().connect<&Scene::OnTransformAdded>(*this);
+		root = CreateRootEntity(UUID());
+
+		gpuScene.Initialize(INITIAL_GPU_SCENE_CAPACITY);
+		m_Registry.on_construct<MeshRendererComponent>().connect<&Scene::OnMeshRendererAdded>(*this);
+		m_Registry.on_destroy<MeshRendererComponent>().connect<&Scene::OnMeshRendererRemoved>(*this);
+		m_Registry.on_construct<MeshRendererComponent>().connect<&Scene::OnMeshBoundsAdded>(*this);
+		m_Registry.on_destroy<MeshRendererComponent>().connect<&Scene::OnMeshBoundsRemoved>(*this);
+		m_Registry.on_construct<LightComponent>().connect<&Scene::OnLightAdded>(*this);
+		m_Registry.on_destroy<LightComponent>().connect<&Scene::OnLightRemoved>(*this);
+		RHI::UVector2D resolution = { (uint32_t)desc.Resolution.x, (uint32_t)desc.Resolution.y };
+		sceneResolution[0] = resolution.x;
+		sceneResolution[1] = resolution.y;
+		clustersDim[0] = desc.clusterX;
+		clustersDim[1] = desc.clusterY;
+		clustersDim[2] = desc.clusterZ;
+		multithreaded = desc.multithreaded;
+		gpuCulling = desc.gpuCulling;
+		occlusionCulling = desc.occlusionCulling;
+		singlePassCascades = desc.singlePassCascades;
+		occlusionCuller.SetResolution(OCCLUSION_BUFFER_WIDTH, OCCLUSION_BUFFER_HEIGHT);
+		ScheduleCascadeUpdates(desc.cascadeUpdateInterval);
+
+		uint32_t numClusters = desc.clusterX * desc.clusterY * desc.clusterZ;
+		uint32_t clusterBufferSize = clusterAABBsize * numClusters;
+
+		clusterAABB.CreateStack(nullptr, clusterBufferSize);
+		sparseActiveClustersBuffer.CreateStack(nullptr, sizeof(uint32_t) * numClusters);
+		lightIndexCapacity = INITIAL_LIGHT_INDEX_CAPACITY;
+		lightIndexList.CreateStack(nullptr, sizeof(uint32_t) * lightIndexCapacity);
+		activeClustersBuffer.CreateStack(nullptr, numClusters * sizeof(uint32_t));
+		lightListSize = INITIAL_LIGHT_LIST_SIZE;
+		lightList.CreateStack(nullptr, lightListSize, SBCreateFlags::AllowCPUAccess);
+		lightGrid.CreateStack(nullptr, numClusters * sizeof(uint32_t) * 4);
+		zPrepass.CreateStack(resolution.x, resolution.y, 1, RHI::Format::D32_FLOAT PT_DEBUG_REGION(, "Scene -> ZPrepass"));
+		depthPyramid.CreateStack(resolution.x, resolution.y PT_DEBUG_REGION(, "Scene -> Depth Pyramid"));
+		finalRender.CreateStack(resolution.x, resolution.y, 1, RHI::Format::R16G16B16A16_FLOAT PT_DEBUG_REGION(, "Scene -> Final Render"));
+		shadowMarker.CreateStack(nullptr, sizeof(uint32_t));
+		shadowMapAtlas.CreateStack(4096, 4096,1, RHI::Format::D32_FLOAT PT_DEBUG_REGION(, "Scene -> Shadow Map"), RHI::TextureUsage::CopyDst);
+		staticShadowAtlas.CreateStack(4096, 4096, 1, RHI::Format::D32_FLOAT PT_DEBUG_REGION(, "Scene -> Static Shadow Cache"), RHI::TextureUsage::CopySrc);
+		computeShaderMiscBuffer.CreateStack(nullptr, sizeof(uint32_t) * 2, SBCreateFlags::None);
+		
+		ComputeShader* shd_buildClusters = Renderer::GetBuiltinComputeShader("Build Clusters");
+		ComputeShader* shd_activeClusters = Renderer::GetBuiltinComputeShader("Filter Clusters");
+		ComputeShader* shd_tightenList = Renderer::GetBuiltinComputeShader("Tighten Clusters");
+		ComputeShader* shd_cullLights = Renderer::GetBuiltinComputeShader("Cull Lights");
+		Shader* shd_prepass = Renderer::GetBuiltinShader("Z-Prepass");
+		const Shader* shd_fwd = &assetMan->GetResource<ShaderAsset>(*assetMan->GetAsset("Default Shader"))->GetShader();
+		Shader* shd_Shadow = Renderer::GetBuiltinShader("Shadow Shader");
+		Shader* shd_background = Renderer::GetBuiltinShader("Background Shader");
+		for (uint32_t i = 0; i < RendererBase::numFramesInFlight; i++)
+		{
+			passCB[i].CreateStack(nullptr, sizeof(PassConstants));
+			shd_buildClusters->GetShaderBinding(passCBinfoCMP[i], 1);
+			shd_prepass->GetShaderBinding(passCBinfoGFX[i], 1);
+			shd_fwd->GetShaderBinding(passCBinfoVS_PS[i], 1);
+
+			BufferBindingUpdateDesc bbud;
+			bbud.buffer = passCB[i].GetID();
+			bbud.size = sizeof(PassConstants);
+			bbud.type = RHI::DescriptorType::ConstantBuffer;
+			bbud.offset = 0;
+			passCBinfoCMP[i].UpdateBufferBinding(bbud, 0);
+			passCBinfoGFX[i].UpdateBufferBinding(bbud, 0);
+			passCBinfoVS_PS[i].UpdateBufferBinding(bbud, 0);
+
+			//bound to the gpu scene by the first UploadDrawData
+			shd_prepass->GetShaderBinding(objectInfoGFX[i], 0);
+			shd_fwd->GetShaderBinding(objectInfoVS_PS[i], 0);
+			instanceBufferSize[i] = INITIAL_INSTANCE_CAPACITY * sizeof(uint32_t);
+			instanceBuffer[i].CreateStack(nullptr, instanceBufferSize[i], SBCreateFlags::AllowCPUAccess);
+		}
+		if (gpuCulling)
+		{
+			//the candidate buffers are per frame and bound by UploadDrawData, the culled ones are shared like the cluster buffers
+			ComputeShader* shd_gpuCull = Renderer::GetBuiltinComputeShader("GPU Culling");
+			culledArgsCapacity = INITIAL_CULLED_RECORD_CAPACITY;
+			culledInstancesCapacity = INITIAL_INSTANCE_CAPACITY;
+			culledArgs.CreateStack(nullptr, culledArgsCapacity * IndirectDrawBuffer::Stride, SBCreateFlags::IndirectArgs);
+			culledInstances.CreateStack(nullptr, culledInstancesCapacity * sizeof(uint32_t));
+			for (uint32_t i = 0; i < RendererBase::numFramesInFlight; i++)
+			{
+				gpuCullCB[i].CreateStack(nullptr, sizeof(GPUCullConstants));
+				boundDrawArgsSize[i] = UINT32_MAX;//bound by the first UploadDrawData
+				shd_gpuCull->GetShaderBinding(gpuCullInfo[i], 0);
+				gpuCullInfo[i].UpdateBufferBinding(gpuCullCB[i].GetID(), 0, sizeof(GPUCullConstants), RHI::DescriptorType::ConstantBuffer, 0);
+				gpuCullInfo[i].UpdateTextureBinding(depthPyramid.GetView(), 6);
+				shd_prepass->GetShaderBinding(culledObjectInfoGFX[i], 0);
+				shd_fwd->GetShaderBinding(culledObjectInfoVS_PS[i], 0);
+			}
+		}
+		shd_fwd->GetShaderBinding(sceneInfo, 2);
+		sceneInfo.UpdateTextureBinding(Renderer::GetBrdfTexture().GetView(), 0);
+		sceneInfo.UpdateTextureBinding(Renderer::GetDefaultCubeMap().GetView(), 1);
+		sceneInfo.UpdateTextureBinding(Renderer::GetDefaultCubeMap().GetView(), 2);
+		sceneInfo.UpdateTextureBinding(shadowMapAtlas.GetView(), 3);
+
+		sceneInfo.UpdateBufferBinding(lightGrid.GetID(), 0, numClusters * sizeof(uint32_t) * 4, RHI::DescriptorType::StructuredBuffer, 4);
+		sceneInfo.UpdateBufferBinding(lightList.GetID(), 0, lightListSize, RHI::DescriptorType::StructuredBuffer, 5);
+		sceneInfo.UpdateBufferBinding(lightIndexList.GetID(), 0, sizeof(uint32_t) * lightIndexCapacity, RHI::DescriptorType::StructuredBuffer, 6);
+
+		sceneInfo.UpdateSamplerBinding(Renderer::GetDefaultSampler(), 7);
+		sceneInfo.UpdateSamplerBinding(Renderer::GetDefaultSampler(), 8);
+		sceneInfo.UpdateSamplerBinding(Renderer::GetShadowSampler(), 9);
+
+		shd_background->GetShaderBinding(backgroundInfo, 1);
+		backgroundInfo.UpdateTextureBinding(Renderer::GetDefaultCubeMap().GetView(), 0);
+		backgroundInfo.UpdateSamplerBinding(Renderer::GetDefaultSampler(), 1);
+
+		shd_Shadow->GetShaderBinding(shadowSetInfo, 1);
+		shadowSetInfo.UpdateBufferBinding(lightList.GetID(), 0, lightListSize, RHI::DescriptorType::StructuredBuffer, 0);
+
+		shd_buildClusters->GetShaderBinding(buildClusterInfo, 0);
+		buildClusterInfo.UpdateBufferBinding(clusterAABB.GetID(), 0, clusterBufferSize, RHI::DescriptorType::CSBuffer, 0);
+		//the first mip reads the depth buffer, every other one the mip before it
+		depthPyramidInfo.resize(depthPyramid.GetNumMips());
+		Renderer::GetBuiltinComputeShader("HiZ First Mip")->GetShaderBinding(depthPyramidInfo[0], 0);
+		depthPyramidInfo[0].UpdateTextureBinding(zPrepass.GetView(), 0);
+		depthPyramidInfo[0].UpdateTextureBinding(depthPyramid.GetMipView(0), 1, RHI::DescriptorType::CSTexture);
+		for (uint32_t mip = 1; mip < depthPyramid.GetNumMips(); mip++)
+		{
+			Renderer::GetBuiltinComputeShader("HiZ Downsample")->GetShaderBinding(depthPyramidInfo[mip], 0);
+			depthPyramidInfo[mip].UpdateTextureBinding(depthPyramid.GetMipView(mip - 1), 0, RHI::DescriptorType::CSTexture);
+			depthPyramidInfo[mip].UpdateTextureBinding(depthPyramid.GetMipView(mip), 1, RHI::DescriptorType::CSTexture);
+		}
+		shd_activeClusters->GetShaderBinding(activeClusterInfo, 0);
+		activeClusterInfo.UpdateTextureBinding(depthPyramid.GetView(), 0);
+		activeClusterInfo.UpdateBufferBinding(sparseActiveClustersBuffer.GetID(), 0, sizeof(uint32_t) * numClusters, RHI::DescriptorType::CSBuffer, 1);
+		shd_tightenList->GetShaderBinding(tightenListInfo, 0);
+		tightenListInfo.UpdateBufferBinding(sparseActiveClustersBuffer.GetID(), 0, sizeof(uint32_t) * numClusters, RHI::DescriptorType::StructuredBuffer, 0);
+		tightenListInfo.UpdateBufferBinding(computeShaderMiscBuffer.GetID(), 0, sizeof(uint32_t), RHI::DescriptorType::CSBuffer, 1);
+		tightenListInfo.UpdateBufferBinding(activeClustersBuffer.GetID(), 0, sizeof(uint32_t) * numClusters, RHI::DescriptorType::CSBuffer, 2);
+		shd_cullLights->GetShaderBinding(cullLightsInfo, 0);
+		cullLightsInfo.UpdateBufferBinding(clusterAABB.GetID(), 0, clusterAABBsize, RHI::DescriptorType::StructuredBuffer, 0);
+		cullLightsInfo.UpdateBufferBinding(activeClustersBuffer.GetID(), 0, sizeof(uint32_t) * numClusters, RHI::DescriptorType::StructuredBuffer, 1);
+		cullLightsInfo.UpdateBufferBinding(lightList.GetID(), 0, lightListSize, RHI::DescriptorType::StructuredBuffer, 2);
+		cullLightsInfo.UpdateBufferBinding(computeShaderMiscBuffer.GetID(), 0, sizeof(uint32_t)*2, RHI::DescriptorType::CSBuffer, 3);
+		cullLightsInfo.UpdateBufferBinding(lightIndexList.GetID(), 0, sizeof(uint32_t) * lightIndexCapacity, RHI::DescriptorType::CSBuffer, 4);
+		cullLightsInfo.UpdateBufferBinding(lightGrid.GetID(), 0, numClusters * sizeof(uint32_t) * 4, RHI::DescriptorType::CSBuffer, 5);
+		for (uint32_t i = 0; i < RendererBase::numFramesInFlight; i++)
+		{
+			uint32_t zero[2] = { 0, 0 };
+			lightIndexReadback[i].CreateStack(zero, sizeof(zero), SBCreateFlags::AllowCPUAccess);
+			shd_cullLights->GetShaderBinding(lightIndexReadbackInfo[i], 2);
+			lightIndexReadbackInfo[i].UpdateBufferBinding(lightIndexReadback[i].GetID(), 0, sizeof(zero), RHI::DescriptorType::CSBuffer, 0);
+		}
+
+		RGTextureHandle depthTex = graph.CreateTexture(&zPrepass);
+		RGTextureHandle pyramidTex = graph.CreateTexture(depthPyramid.GetID(), 0, false, 0, 1, depthPyramid.GetNumMips());
+		finalRenderTex = graph.CreateTexture(&finalRender);
+		RGTextureHandle shadowMap = graph.CreateTexture(&shadowMapAtlas);
+		RGTextureHandle staticShadowMap = graph.CreateTexture(&staticShadowAtlas);
+		RGTextureInstance cachedShadowMap = graph.MakeUniqueInstance(shadowMap);//the atlas once the static depth was copied in
+		RGBufferHandle clustersBuffer = graph.CreateBuffer(clusterAABB.GetID(), 0, clusterBufferSize);
+		RGBufferHandle sparseActiveClusterBuffer = graph.CreateBuffer(sparseActiveClustersBuffer.GetID(), 0, sizeof(uint32_t) * numClusters);
+		RGBufferHandle ActiveClusterBuffer = graph.CreateBuffer(activeClustersBuffer.GetID(), 0, numClusters * sizeof(uint32_t));
+		RGBufferHandle LightIndices = graph.CreateBuffer(lightIndexList.GetID(), 0, sizeof(uint32_t) * lightIndexCapacity);
+		lightIndicesHandle = LightIndices;
+		RGBufferHandle LightList = graph.CreateBuffer(lightList.GetID(), 0, lightListSize);//light list is transient as it switches queue families
+		lightListHandle = LightList;
+		RGBufferHandle LightGrid = graph.CreateBuffer(lightGrid.GetID(), 0, numClusters * 4 * sizeof(uint32_t));
+		RGTextureInstance finalRenderWithBackground = graph.MakeUniqueInstance(finalRenderTex);
+		if (gpuCulling)
+		{
+			culledArgsHandle = graph.CreateBuffer(culledArgs.GetID(), 0, culledArgsCapacity * IndirectDrawBuffer::Stride);
+			culledInstancesHandle = graph.CreateBuffer(culledInstances.GetID(), 0, culledInstancesCapacity * sizeof(uint32_t));
+		}
+
+		AttachmentInfo a_info;
+		BufferAttachmentInfo b_info;
+		Matrix4 view = Matrix4::CreateLookAt({ 0,3,-10 }, { 0,0,0 }, { 0,1,0 });;
+		Matrix4 proj = Matrix4::CreatePerspectiveFieldOfView(Math::ToRadians(45.f), 16.f / 9.f, 0.1, 50.f);
+		PassConstants pc;
+		XMStoreFloat4x4(&pc.View, XMMatrixTranspose(view));
+		XMStoreFloat4x4(&pc.Proj, XMMatrixTranspose(proj));
+		XMStoreFloat4x4(&pc.ViewProj, XMMatrixMultiplyTranspose(view, proj));
+		XMStoreFloat4x4(&pc.InvProj, XMMatrixTranspose(XMMatrixInverse(nullptr, proj)));
+		XMStoreFloat4x4(&pc.InvView, XMMatrixTranspose(XMMatrixInverse(nullptr, view)));
+		XMStoreFloat4x4(&pc.InvViewProj, XMMatrixTranspose(XMMatrixInverse(nullptr, view * proj)));
+		pc.numClusters = { 16,9,24 };
+		pc.RenderTargetSize = { 1920,1080 };
+		pc.NearZ = 0.1f;
+		pc.FarZ = 50.f;
+		pc.InvRenderTargetSize = { 1.f / 1920.f, 1.f / 1080.f };
+		pc.bias = (24.f * log10f(0.1f)) / (log10f(50.f / 0.1f));
+		pc.scale = 24.f / (log10f(50.f / 0.1f));
+		pc.numClusters = { 16,9,24 };
+		pc.numDirectionalRegularLights = 0;
+		pc.numDirectionalShadowLights = 0;
+		pc.numRegularLights = 0;
+		pc.numShadowLights = 0;
+		pc.EyePosW = { 0,3,-10 };
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			passCB[i].Update(&pc, sizeof(PassConstants), 0);
+		}
+
+		if (gpuCulling)
+		{
+			ComputePass& gpuCull = graph.AddComputePass("GPU Culling");
+			BufferAttachmentInfo args_info{ culledArgsHandle, AttachmentUsage::Compute };
+			BufferAttachmentInfo instances_info{ culledInstancesHandle, AttachmentUsage::Compute };
+			gpuCull.AddBufferOutput(&args_info);
+			gpuCull.AddBufferOutput(&instances_info);
+			gpuCull.SetShader(Renderer::GetBuiltinComputeShader("GPU Culling"));
+			gpuCull.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
+				{
+					//one group per prepass and opaque record, they come first in drawArgs so shadowDrawBase is their count
+					//the depth pyramid isn't an input on purpose: it's last frame's, this frame's is only built after the prepass
+					if (!shadowDrawBase) return;
+					ComputeShader* shd = Renderer::GetBuiltinComputeShader("GPU Culling");
+					shd->ApplyShaderBinding(list, passCBinfoCMP[RendererBase::GetCurrentFrameIndex()]);
+					shd->ApplyShaderBinding(list, gpuCullInfo[RendererBase::GetCurrentFrameIndex()]);
+					list->Dispatch(shadowDrawBase, 1, 1);
+				};
+		}
+		RenderPass& zprepass = graph.AddPass(RHI::PipelineStage::LATE_FRAGMENT_TESTS_BIT, "Z-Prepass");
+		{
+			if (gpuCulling)
+			{
+				b_info.buffer = culledArgsHandle;
+				b_info.usage = AttachmentUsage::Graphics;
+				BufferAttachmentInfo instances_info{ culledInstancesHandle, AttachmentUsage::Graphics };
+				zprepass.AddBufferInput(&b_info);
+				zprepass.AddBufferInput(&instances_info);
+			}
+			a_info.format = RHI::Format::D32_FLOAT;//?
+			a_info.access = AttachmentAccess::Write;
+			a_info.usage = AttachmentUsage::Graphics;
+			a_info.texture = depthTex;
+			zprepass.SetDepthStencilOutput(&a_info);
+			zprepass.SetPassArea({ {0,0}, resolution });
+			zprepass.SetShader(shd_prepass);
+			zprepass.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list) 
+				{
+					RHI::Viewport vp;
+					vp.height = sceneResolution[1];
+					vp.width = sceneResolution[0];
+					vp.minDepth = 0;
+					vp.maxDepth = 1;
+					vp.x = vp.y = 0;
+					list->SetViewports(1, &vp);
+					RHI::Area2D rect = { {0,0},{sceneResolution[0],sceneResolution[1]}};
+					list->SetScissorRects(1, &rect);
+					Shader* shd = Renderer::GetBuiltinShader("Z-Prepass");
+					list->SetRootSignature(shd->GetRootSignature());
+					shd->ApplyBinding(list, passCBinfoGFX[RendererBase::GetCurrentFrameIndex()]);
+					shd->ApplyBinding(list, (gpuCulling ? culledObjectInfoGFX : objectInfoGFX)[RendererBase::GetCurrentFrameIndex()]);
+					list->BindVertexBuffers(0, 1, &Renderer::GetVertexBuffer()->ID);
+					list->BindIndexBuffer(Renderer::GetIndexBuffer(), 0);
+					//a single pipeline, every batch (one per mesh, instances front to back) is one record of a single indirect call
+					uint32_t numBatches = (uint32_t)prepassQueue.GetBatches().size();
+					if (!numBatches) return;
+					uint32_t firstRecord = 0;
+					SubmitRecords(list, GetMeshDrawArgs(), 0, numBatches, &firstRecord, 1);
+					stats.numDraws += numBatches;
+					stats.numDrawCalls++;
+				};
+		}
+		RenderPass& staticShadow = graph.AddPass(RHI::PipelineStage::LATE_FRAGMENT_TESTS_BIT, "Static Shadow");
+		{
+			a_info.format = RHI::Format::D32_FLOAT;
+			a_info.access = AttachmentAccess::ReadWrite;//views that are still valid keep their depth
+			a_info.usage = AttachmentUsage::Unspec;
+			a_info.texture = staticShadowMap;
+			b_info.buffer = LightList;
+			b_info.usage = AttachmentUsage::Graphics;
+			staticShadow.SetDepthStencilOutput(&a_info);
+			staticShadow.AddBufferOutput(&b_info);
+			staticShadow.SetPassArea({ {0,0}, {staticShadowAtlas.GetWidth(), staticShadowAtlas.GetHeight()} });
+			staticShadow.SetShader(shd_Shadow);
+			staticShadow.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
+				{
+					RHI::RenderingAttachmentDesc attachDesc{};
+					attachDesc.clearColor = { 1,1,1,1 };
+					attachDesc.ImageView = RendererBase::GetCPUHandle(staticShadowAtlas.DSView.Get());
+					attachDesc.loadOp = RHI::LoadOp::Clear;
+					attachDesc.storeOp = RHI::StoreOp::Store;
+					RHI::RenderingBeginDesc rbDesc{};
+					rbDesc.pDepthStencilAttachment = &attachDesc;
+
+					uint32_t baseOffset = (regularLights.size() * sizeof(RegularLight)) / (sizeof(float) * 4);
+					uint32_t offsetMul = sizeof(ShadowCastingLight) / (sizeof(float) * 4);
+					Shader* shd = Renderer::GetBuiltinShader("Shadow Shader");
+					for (uint32_t index = 0; index < shadowLights.size(); index++)
+					{
+						const auto& light = shadowLights[index];
+						if (singlePassCascades && light.light.type == LightType::Directional) continue;
+						for (uint32_t i = 0; i < 4; i++)
+						{
+							if (!(shadowViewActions[index * 4 + i] & ShadowRenderStatic)) continue;
+							RHI::Area2D rect = GetShadowViewArea(light, i);
+							RHI::Viewport vp;
+							vp.x = (float)rect.offset.x; vp.y = (float)rect.offset.y;
+							vp.width = (float)rect.size.width; vp.height = (float)rect.size.height;
+							vp.minDepth = 0; vp.maxDepth = 1;
+							shd->ApplyBinding(list, shadowSetInfo);
+							shd->ApplyBinding(list, objectInfoGFX[RendererBase::GetCurrentFrameIndex()]);
+							list->SetViewports(1, &vp);
+							list->SetScissorRects(1, &rect);
+							uint32_t offset_cascade[3] = { baseOffset + (index * offsetMul), i, 0 };
+							rbDesc.renderingArea = rect;
+							list->BeginRendering(rbDesc);
+							const CasterList& casters = casterLists[(index * 4 + i) * 2];
+							if (casters.numBatches)
+							{
+								SubmitRecords(list, drawArgs.GetBuffer(RendererBase::GetCurrentFrameIndex()), shadowDrawBase + casters.firstBatch, casters.numBatches, offset_cascade, 3);
+								stats.numStaticShadowDraws += casters.numBatches;
+								stats.numShadowDrawCalls++;
+							}
+							list->EndRendering();
+						}
+					}
+					//binds its own shader, so it goes last
+					if (singlePassCascades)
+						for (uint32_t index = 0; index < shadowLights.size(); index++)
+							if (shadowLights[index].light.type == LightType::Directional) DrawCascades(list, attachDesc, index, 0);
+				};
+		}
+		RenderPass& shadowCacheCopy = graph.AddPass(RHI::PipelineStage::TRANSFER_BIT, "Shadow Cache Copy");
+		{
+			a_info.format = RHI::Format::D32_FLOAT;
+			a_info.access = AttachmentAccess::Read;
+			a_info.usage = AttachmentUsage::Blit;
+			a_info.texture = staticShadowMap;
+			shadowCacheCopy.AddColorInput(&a_info);
+			a_info.access = AttachmentAccess::Write;
+			a_info.texture = cachedShadowMap;
+			shadowCacheCopy.AddColorOutput(&a_info);
+			shadowCacheCopy.SetPassArea({ {0,0}, {shadowMapAtlas.GetWidth(), shadowMapAtlas.GetHeight()} });
+			shadowCacheCopy.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
+				{
+					RHI::SubResourceRange range;
+					range.IndexOrFirstMipLevel = 0;
+					range.FirstArraySlice = 0;
+					range.NumArraySlices = 1;
+					range.NumMipLevels = 1;
+					range.imageAspect = RHI::Aspect::DEPTH_BIT;
+					for (uint32_t index = 0; index < shadowLights.size(); index++)
+					{
+						for (uint32_t i = 0; i < 4; i++)
+						{
+							if (!(shadowViewActions[index * 4 + i] & ShadowCopyStatic)) continue;
+							RHI::Area2D rect = GetShadowViewArea(shadowLights[index], i);
+							RHI::Extent3D size = { rect.size.width, rect.size.height, 1 };
+							RHI::Offset3D offset = { rect.offset.x, rect.offset.y, 0 };
+							list->BlitTexture(staticShadowAtlas.GetID(), shadowMapAtlas.GetID(), size, offset, size, offset, range, range);
+						}
+					}
+				};
+		}
+		//every shadow pass starts from the atlas with the static depth copied in, the point light pass only orders itself after it
+		AttachmentInfo cached_info{ RHI::Format::D32_FLOAT, cachedShadowMap, AttachmentAccess::Read, AttachmentUsage::PassThrough };
+		//draws the dynamic casters of every view of @type over the copied static depth
+		auto drawDynamicCasters = [this](RHI::Weak<RHI::GraphicsCommandList> list, LightType type)
+			{
+				RHI::RenderingAttachmentDesc attachDesc{};
+				attachDesc.ImageView = RendererBase::GetCPUHandle(shadowMapAtlas.DSView.Get());
+				attachDesc.loadOp = RHI::LoadOp::Load;
+				attachDesc.storeOp = RHI::StoreOp::Store;
+				if (singlePassCascades && type == LightType::Directional)
+				{
+					for (uint32_t index = 0; index < shadowLights.size(); index++)
+						if (shadowLights[index].light.type == type) DrawCascades(list, attachDesc, index, 1);
+					return;
+				}
+				RHI::RenderingBeginDesc rbDesc{};
+				rbDesc.pDepthStencilAttachment = &attachDesc;
+
+				uint32_t baseOffset = (regularLights.size() * sizeof(RegularLight)) / (sizeof(float) * 4);
+				uint32_t offsetMul = sizeof(ShadowCastingLight) / (sizeof(float) * 4);
+				Shader* shd = Renderer::GetBuiltinShader("Shadow Shader");
+				for (uint32_t index = 0; index < shadowLights.size(); index++)
+				{
+					const auto& light = shadowLights[index];
+					if (light.light.type != type) continue;
+					for (uint32_t i = 0; i < 4; i++)
+					{
+						if (!(shadowViewActions[index * 4 + i] & ShadowDrawDynamic)) continue;
+						RHI::Area2D rect = GetShadowViewArea(light, i);
+						RHI::Viewport vp;
+						vp.x = (float)rect.offset.x; vp.y = (float)rect.offset.y;
+						vp.width = (float)rect.size.width; vp.height = (float)rect.size.height;
+						vp.minDepth = 0; vp.maxDepth = 1;
+						shd->ApplyBinding(list, shadowSetInfo);
+						shd->ApplyBinding(list, objectInfoGFX[RendererBase::GetCurrentFrameIndex()]);
+						list->SetViewports(1, &vp);
+						list->SetScissorRects(1, &rect);
+						uint32_t offset_cascade[3] = { baseOffset + (index * offsetMul), i, 0 };
+						rbDesc.renderingArea = rect;
+						list->BeginRendering(rbDesc);
+						//only the dynamic meshes touching this view, one instanced draw per mesh
+						const CasterList& casters = casterLists[(index * 4 + i) * 2 + 1];
+						SubmitRecords(list, drawArgs.GetBuffer(RendererBase::GetCurrentFrameIndex()), shadowDrawBase + casters.firstBatch, casters.numBatches, offset_cascade, 3);
+						stats.numShadowDraws += casters.numBatches;
+						stats.numShadowDrawCalls += casters.numBatches ? 1 : 0;
+						list->EndRendering();
+					}
+				}
+			};
+		RenderPass& dirShadow = graph.AddPass(RHI::PipelineStage::LATE_FRAGMENT_TESTS_BIT, "Directional Shadow");
+		{
+			a_info.format = RHI::Format::D32_FLOAT;//?
+			a_info.access = AttachmentAccess::ReadWrite;
+			a_info.usage = AttachmentUsage::Unspec;
+			a_info.texture = shadowMap;
+			b_info.buffer = LightList;
+			b_info.usage = AttachmentUsage::Graphics;
+			dirShadow.AddColorInput(&cached_info);
+			dirShadow.SetDepthStencilOutput(&a_info);
+			dirShadow.AddBufferOutput(&b_info);
+			dirShadow.SetPassArea({ {0,0}, {shadowMapAtlas.GetWidth(), shadowMapAtlas.GetHeight()} });
+			dirShadow.SetShader(shd_Shadow);
+			dirShadow.pass_fn = [drawDynamicCasters](RHI::Weak<RHI::GraphicsCommandList> list) { drawDynamicCasters(list, LightType::Directional); };
+		}
+		RenderPass& pntShadow = graph.AddPass(RHI::PipelineStage::LATE_FRAGMENT_TESTS_BIT, "Point Shadow");
+		{
+			a_info.format = RHI::Format::D32_FLOAT;//?
+			a_info.access = AttachmentAccess::ReadWrite;//dont clear the shadow map
+			a_info.usage = AttachmentUsage::Graphics;
+			a_info.texture = shadowMap;
+			pntShadow.AddColorInput(&cached_info);
+			pntShadow.SetDepthStencilOutput(&a_info);
+			pntShadow.SetPassArea({ {0,0}, {shadowMapAtlas.GetWidth(), shadowMapAtlas.GetHeight()} });;
+			//sptShadow.SetShader(nullptr);
+			pntShadow.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list) {
+				};
+		}
+		RenderPass& sptShadow = graph.AddPass(RHI::PipelineStage::ALL_GRAPHICS_BIT, "Spot Shadow");
+		{
+			a_info.format = RHI::Format::D32_FLOAT;//?
+			a_info.access = AttachmentAccess::ReadWrite;
+			a_info.usage = AttachmentUsage::Unspec;
+			a_info.texture = shadowMap;
+			b_info.buffer = LightList;
+			b_info.usage = AttachmentUsage::Graphics;
+			sptShadow.AddColorInput(&cached_info);
+			sptShadow.SetDepthStencilOutput(&a_info);
+			sptShadow.AddBufferOutput(&b_info);
+			sptShadow.SetShader(shd_Shadow);
+			sptShadow.pass_fn = [drawDynamicCasters](RHI::Weak<RHI::GraphicsCommandList> list) { drawDynamicCasters(list, LightType::Spot); };
+		}
+		ComputePass& buildClusters = graph.AddComputePass("Build Clusters");
+		{
+			b_info.usage = AttachmentUsage::Compute;
+			b_info.buffer = clustersBuffer;
+			buildClusters.AddBufferOutput(&b_info);
+			buildClusters.SetShader(Renderer::GetBuiltinComputeShader("Build Clusters"));
+			buildClusters.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list) 
+				{
+					ComputeShader* shd = Renderer::GetBuiltinComputeShader("Build Clusters");
+					shd->ApplyShaderBinding(list, passCBinfoCMP[RendererBase::GetCurrentFrameIndex()]);
+					shd->ApplyShaderBinding(list, buildClusterInfo);
+					list->Dispatch(clustersDim[0], clustersDim[1], clustersDim[2]);
+					list->MarkBuffer(graph.dbgBufferCMP, 3);
+				};
+		}
+		ComputePass& buildPyramid = graph.AddComputePass("Depth Pyramid");
+		{
+			a_info.format = RHI::Format::D32_FLOAT;
+			a_info.access = AttachmentAccess::Read;
+			a_info.texture = depthTex;
+			a_info.usage = AttachmentUsage::Compute;
+			buildPyramid.AddColorInput(&a_info);
+			a_info.format = DepthPyramid::Format;
+			a_info.access = AttachmentAccess::Write;
+			a_info.texture = pyramidTex;
+			buildPyramid.AddColorOutput(&a_info);
+			buildPyramid.SetShader(Renderer::GetBuiltinComputeShader("HiZ First Mip"));
+			buildPyramid.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
+				{
+					ComputeShader* shd = Renderer::GetBuiltinComputeShader("HiZ First Mip");
+					shd->ApplyShaderBinding(list, depthPyramidInfo[0]);
+					list->Dispatch((depthPyramid.GetWidth(0) + 7) / 8, (depthPyramid.GetHeight(0) + 7) / 8, 1);
+					if (depthPyramid.GetNumMips() == 1) return;
+					shd = Renderer::GetBuiltinComputeShader("HiZ Downsample");
+					shd->Bind(list);
+					//the whole chain is in GENERAL for the pass, every mip only has to be written before the next one reads it
+					RHI::TextureMemoryBarrier barr;
+					barr.AccessFlagsBefore = RHI::ResourceAcessFlags::SHADER_WRITE;
+					barr.AccessFlagsAfter = RHI::ResourceAcessFlags::SHADER_READ;
+					barr.oldLayout = barr.newLayout = RHI::ResourceLayout::GENERAL;
+					barr.previousQueue = barr.nextQueue = RHI::QueueFamily::Ignored;
+					barr.texture = depthPyramid.GetID();
+					barr.subresourceRange.FirstArraySlice = 0;
+					barr.subresourceRange.NumArraySlices = 1;
+					barr.subresourceRange.NumMipLevels = 1;
+					barr.subresourceRange.imageAspect = RHI::Aspect::COLOR_BIT;
+					for (uint32_t mip = 1; mip < depthPyramid.GetNumMips(); mip++)
+					{
+						barr.subresourceRange.IndexOrFirstMipLevel = mip - 1;
+						list->PipelineBarrier(RHI::PipelineStage::COMPUTE_SHADER_BIT, RHI::PipelineStage::COMPUTE_SHADER_BIT, {}, { &barr,1 });
+						shd->ApplyShaderBinding(list, depthPyramidInfo[mip]);
+						list->Dispatch((depthPyramid.GetWidth(mip) + 7) / 8, (depthPyramid.GetHeight(mip) + 7) / 8, 1);
+					}
+				};
+		}
+		ComputePass& filterClusters = graph.AddComputePass("Filter Clusters");
+		{
+			a_info.format = DepthPyramid::Format;
+			a_info.access = AttachmentAccess::Read;
+			a_info.texture = pyramidTex;
+			a_info.usage = AttachmentUsage::Compute;
+			filterClusters.AddColorInput(&a_info);
+			b_info.usage = AttachmentUsage::Compute;
+			b_info.buffer = sparseActiveClusterBuffer;
+			filterClusters.AddBufferOutput(&b_info);
+			filterClusters.SetShader(Renderer::GetBuiltinComputeShader("Filter Clusters"));
+			filterClusters.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
+				{
+					ComputeShader* shd = Renderer::GetBuiltinComputeShader("Filter Clusters");
+					shd->ApplyShaderBinding(list, passCBinfoCMP[RendererBase::GetCurrentFrameIndex()]);
+					shd->ApplyShaderBinding(list, activeClusterInfo);
+					//one thread per 2x2 pixels, the first mip already holds their depth range
+					list->Dispatch(depthPyramid.GetWidth(0), depthPyramid.GetHeight(0), 1);
+					list->MarkBuffer(graph.dbgBufferCMP,4);
+				};
+		}
+		ComputePass& tightenCluster = graph.AddComputePass("Tighten Cluster List");
+		{
+			b_info.buffer = sparseActiveClusterBuffer;
+			b_info.usage = AttachmentUsage::Compute;
+			BufferAttachmentInfo b_info2;
+			b_info2.buffer = ActiveClusterBuffer;
+			b_info2.usage = AttachmentUsage::Compute;
+			tightenCluster.AddBufferInput(&b_info);
+			tightenCluster.AddBufferOutput(&b_info2);
+			tightenCluster.SetShader(Renderer::GetBuiltinComputeShader("Tighten Clusters"));
+			tightenCluster.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
+				{
+					ComputeShader* shd = Renderer::GetBuiltinComputeShader("Tighten Clusters");
+					shd->ApplyShaderBinding(list, passCBinfoCMP[RendererBase::GetCurrentFrameIndex()]);
+					shd->ApplyShaderBinding(list, tightenListInfo);
+					list->Dispatch(clustersDim[0], clustersDim[1], clustersDim[2]);
+					list->MarkBuffer(graph.dbgBufferCMP, 5);
+				};
+		}
+		ComputePass& cullLights = graph.AddComputePass("Light Culling");
+		{
+			b_info.buffer = LightIndices;
+			b_info.usage = AttachmentUsage::Compute;
+			BufferAttachmentInfo b_info2{ LightList, AttachmentUsage::Compute };
+			BufferAttachmentInfo b_info3{ LightGrid, AttachmentUsage::Compute };
+			BufferAttachmentInfo b_info4{ ActiveClusterBuffer, AttachmentUsage::Compute };
+			cullLights.AddBufferInput(&b_info4);
+			cullLights.AddBufferOutput(&b_info);
+			cullLights.AddBufferInput(&b_info2);
+			cullLights.AddBufferOutput(&b_info3);
+			cullLights.SetShader(Renderer::GetBuiltinComputeShader("Cull Lights"));
+			cullLights.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
+				{
+					ComputeShader* shd = Renderer::GetBuiltinComputeShader("Cull Lights");
+					shd->ApplyShaderBinding(list, passCBinfoCMP[RendererBase::GetCurrentFrameIndex()]);
+					shd->ApplyShaderBinding(list, cullLightsInfo);
+					shd->ApplyShaderBinding(list, lightIndexReadbackInfo[RendererBase::GetCurrentFrameIndex()]);
+					list->Dispatch(clustersDim[0], clustersDim[1], clustersDim[2]);
+					list->MarkBuffer(graph.dbgBufferCMP, 6);
+					list->MarkBuffer(computeShaderMiscBuffer.GetID(), 0, 0);
+					list->MarkBuffer(computeShaderMiscBuffer.GetID(), 4, 0);
+				};
+		}
+		RenderPass& fwdShading = graph.AddPass(RHI::PipelineStage::ALL_GRAPHICS_BIT, "Forward Shading");
+		{
+			b_info.buffer = LightIndices;
+			b_info.usage = AttachmentUsage::Graphics;
+			BufferAttachmentInfo b_info2{ LightList, AttachmentUsage::Graphics };
+			BufferAttachmentInfo b_info3{ LightGrid, AttachmentUsage::Graphics };
+			fwdShading.AddBufferInput(&b_info);
+			fwdShading.AddBufferInput(&b_info2);
+			fwdShading.AddBufferInput(&b_info3);
+			if (gpuCulling)
+			{
+				BufferAttachmentInfo args_info{ culledArgsHandle, AttachmentUsage::Graphics };
+				BufferAttachmentInfo instances_info{ culledInstancesHandle, AttachmentUsage::Graphics };
+				fwdShading.AddBufferInput(&args_info);
+				fwdShading.AddBufferInput(&instances_info);
+			}
+			a_info.format = RHI::Format::D32_FLOAT;
+			a_info.texture = shadowMap;
+			a_info.access = AttachmentAccess::Read;
+			a_info.usage = AttachmentUsage::Graphics;
+			fwdShading.AddColorInput(&a_info);
+			a_info.format = RHI::Format::R16G16B16A16_FLOAT;
+			a_info.texture = finalRenderTex;
+			a_info.access = AttachmentAccess::Write;
+			fwdShading.AddColorOutput(&a_info);
+			a_info.format = RHI::Format::D32_FLOAT;
+			a_info.texture = depthTex;
+			a_info.access = AttachmentAccess::Read;
+			a_info.usage = AttachmentUsage::Graphics;
+			fwdShading.SetDepthStencilOutput(&a_info);
+			//fwdShading.SetShader(); we dont set shader because of custom shader support
+			fwdShading.SetPassArea({ { 0,0},resolution });
+			fwdShading.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
+				{
+					RHI::Viewport vp;
+					vp.height = sceneResolution[1];
+					vp.width = sceneResolution[0];
+					vp.minDepth = 0;
+					vp.maxDepth = 1;
+					vp.x = vp.y = 0;
+					list->SetViewports(1, &vp);
+					RHI::Area2D rect = { 0,0,sceneResolution[0],sceneResolution[1] };
+					list->SetScissorRects(1, &rect);
+					AssetManager* assetMan = GetAssetManager();
+					list->BindVertexBuffers(0, 1, &Renderer::GetVertexBuffer()->ID);
+					list->BindIndexBuffer(Renderer::GetIndexBuffer(), 0);
+					//draws come sorted by shader then material, state is only rebound when it changes,
+					//every run of the same material and mesh is a single instanced draw and the draws of a material a single indirect call,
+					//the vertex shader finds a draw's instances through the pushed first record and its draw index
+					const Shader* boundShader = nullptr;
+					std::span<const RenderQueue::Item> items = opaqueQueue.GetItems();
+					std::span<const RenderQueue::Batch> batches = opaqueQueue.GetBatches();
+					for (uint32_t b = 0; b < batches.size();)
+					{
+						//the upper half of an opaque batch key is the material
+						const uint64_t materialKey = items[batches[b].first].batch >> 32;
+						uint32_t end = b + 1;
+						while (end < batches.size() && (items[batches[end].first].batch >> 32) == materialKey) end++;
+						auto& meshc = m_Registry.get<MeshRendererComponent>(items[batches[b].first].entity);
+						const auto* mtl = assetMan->GetResource<Material>(meshc.material);
+						const Shader& shd = assetMan->GetResource<ShaderAsset>(mtl->GetShader())->GetShader();
+						if (&shd != boundShader)
+						{
+							shd.Bind(list);
+							shd.ApplyBinding(list, (gpuCulling ? culledObjectInfoVS_PS : objectInfoVS_PS)[RendererBase::GetCurrentFrameIndex()]);
+							shd.ApplyBinding(list, passCBinfoVS_PS[RendererBase::GetCurrentFrameIndex()]);
+							shd.ApplyBinding(list, sceneInfo);
+							boundShader = &shd;
+							stats.numShaderBinds++;
+						}
+						Renderer::FullCBUpdate(mtl->parametersBuffer, mtl->parametersBufferCPU);
+						mtl->BindParameters(list);
+						stats.numMaterialBinds++;
+						uint32_t firstRecord = 0;
+						SubmitRecords(list, GetMeshDrawArgs(), opaqueDrawBase + b, end - b, &firstRecord, 1);
+						stats.numDraws += end - b;
+						stats.numDrawCalls++;
+						b = end;
+					}
+				};
+			
+		}
+		RenderPass& backgroundPass = graph.AddPass(RHI::PipelineStage::ALL_GRAPHICS_BIT, "Background Pass");
+		{
+			a_info.format = RHI::Format::R16G16B16A16_FLOAT;
+			a_info.texture = finalRenderTex;
+			a_info.access = AttachmentAccess::Read;
+			backgroundPass.AddColorInput(&a_info);
+			a_info.texture = finalRenderWithBackground;
+			backgroundPass.AddColorOutput(&a_info);
+			a_info.format = RHI::Format::D32_FLOAT;
+			a_info.texture = depthTex;
+			a_info.access = AttachmentAccess::Read;
+			a_info.usage = AttachmentUsage::Graphics;
+			backgroundPass.SetDepthStencilOutput(&a_info);
+			backgroundPass.SetShader(shd_background);
+			backgroundPass.SetPassArea({ { 0,0},resolution });
+			backgroundPass.pass_fn = [this](RHI::Weak<RHI::GraphicsCommandList> list)
+			{
+				RHI::Viewport vp;
+				vp.height = sceneResolution[1];
+				vp.width = sceneResolution[0];
+				vp.minDepth = 0;
+				vp.maxDepth = 1;
+				vp.x = vp.y = 0;
+				list->SetViewports(1, &vp);
+				RHI::Area2D rect = { 0,0,sceneResolution[0],sceneResolution[1] };
+				list->SetScissorRects(1, &rect);
+				auto* shader = Renderer::GetBuiltinShader("Background Shader");
+				auto& cb_info = passCBinfoGFX[RendererBase::GetCurrentFrameIndex()];
+				uint32_t old_ind = cb_info.setIndex;
+				cb_info.setIndex = 0;
+				shader->ApplyBinding(list, passCBinfoGFX[RendererBase::GetCurrentFrameIndex()]);
+				cb_info.setIndex = old_ind;
+				shader->ApplyBinding(list, backgroundInfo);
+				Renderer::Submit(list, Renderer::UnitCube()->GetVBHandle(), Renderer::UnitCube()->GetIBHandle(), sizeof(Vertex));
+			};
+		}
+		graph.Compile();
+
+		//graph.Execute();
+		//graph.SubmitToQueue();
+	}
+	Scene::~Scene()
+	{
+	}
+	Entity Scene::CreateRootEntity(UUID ID)
+	{
+		Entity entity = { m_Registry.create(), this };
+		entity.AddComponent<IDComponent>(ID);
+		auto& hierarchy = entity.AddComponent<HierarchyComponent>();
+		hierarchy.parentID = entt::null;
+		hierarchy.node = transformHierarchy.CreateNode(entity, TransformHierarchy::InvalidNode);
+		entity.AddComponent<TransformComponent>();
+		entity.AddComponent<TagComponent>("Root");
+		return entity;
+	}
+	Entity Scene::CreateEntity(const std::string& name)
+	{
+		return CreateEntityWithUUID(UUID(), name);
+	}
+	Entity Scene::DuplicateEntity(Entity entity)
+	{
+		if (entity.GetComponent<HierarchyComponent>().parentID == entt::null)
+			return entity;
+		Entity newEntity = CreateEntity(entity.GetComponent<TagComponent>().Tag + "-Copy");
+		newEntity.GetComponent<TransformComponent>() = entity.GetComponent<TransformComponent>();
+		ReparentEntity(newEntity, Entity(entity.GetComponent<HierarchyComponent>().parentID, this));
+		if (entity.HasComponent<LightComponent>()) newEntity.AddComponent<LightComponent>(entity.GetComponent<LightComponent>());
+		if (entity.HasComponent<SpriteRendererComponent>()) newEntity.AddComponent<SpriteRendererComponent>() = entity.GetComponent<SpriteRendererComponent>();
+		if (entity.HasComponent<MeshRendererComponent>()) newEntity.AddComponent<MeshRendererComponent>(entity.GetComponent<MeshRendererComponent>());
+		if (entity.HasComponent<RigidBodyComponent>()) newEntity.AddComponent<RigidBodyComponent>() = entity.GetComponent<RigidBodyComponent>();
+		if (entity.HasComponent<BoxColliderComponent>()) newEntity.AddComponent<BoxColliderComponent>() = entity.GetComponent<BoxColliderComponent>();
+		if (entity.HasComponent<SphereColliderComponent>()) newEntity.AddComponent<SphereColliderComponent>() = entity.GetComponent<SphereColliderComponent>();
+		return newEntity;
+	}
+	void Scene::ReparentEntity(Entity e, Entity new_parent)
+	{
+		if(e == root || e == new_parent) return;
+		auto view = m_Registry.view<HierarchyComponent>();
+		auto& child = view.get<HierarchyComponent>(e);
+		auto& new_tree = view.get<HierarchyComponent>(new_parent);
+		//an entity queued for deletion has already left the transform hierarchy, it can't be moved or take children
+		if (child.node == TransformHierarchy::InvalidNode || new_tree.node == TransformHierarchy::InvalidNode) return;
+		//if new parent is a child of e return
+		entt::entity iter = new_tree.parentID;
+		while(iter != entt::null)
+		{
+			if(iter == e) return;
+			iter = view.get<HierarchyComponent>(iter).parentID;
+		}
+		child.parentID = new_parent;
+		transformHierarchy.Reparent(child.node, new_tree.node);
+	}
+	void Scene::ForEachChild(Entity entity, const std::function<void(Entity)>& fn)
+	{
+		transformHierarchy.ForEachChild(m_Registry.get<HierarchyComponent>(entity).node, [&](entt::entity child) { fn(Entity(child, this)); });
+	}
+
+	void Scene::SyncSkybox()
+	{
+		auto& env = m_Registry.get<EnvironmentComponent>(root);
+		auto skybox = GetAssetManager()->GetResource<Skybox>(env.skybox);
+		sceneInfo.UpdateTextureBinding(skybox->Irradiance()->GetView(), 1);
+		sceneInfo.UpdateTextureBinding(skybox->SpecularPrefiltered()->GetView(), 2);
+
+		backgroundInfo.UpdateTextureBinding(skybox->Base()->GetView(), 0);
+	}
+
+	Entity Scene::CreateEntityWithUUID(UUID ID, const std::string& name)
+	{
+		Entity entity = { m_Registry.create(), this };
+		entity.AddComponent<IDComponent>(ID);
+		auto& hierarchy = entity.AddComponent<HierarchyComponent>(root);
+		hierarchy.node = transformHierarchy.CreateNode(entity, m_Registry.get<HierarchyComponent>(root).node);
+		entity.AddComponent<TransformComponent>();
+		char id[100] = {'E','n','t','i','t', 'y', '0', '0', '0', '\0'};
+		sprintf(id+6,"%u",((uint32_t)entity));
+		//the tag is indexed on construction, so it's built with its final name
+		entity.AddComponent<TagComponent>(name.empty() ? std::string(id) : name);
+		return entity;
+	}
+	void Scene::OnRuntimeStop()
+	{
+	}
+	void Scene::DestroyEntity(Entity entity)
+	{
+		auto& hierarchy = m_Registry.get<HierarchyComponent>(entity);
+		if (hierarchy.node == TransformHierarchy::InvalidNode) return;
+		destroyedEntities.clear();
+		transformHierarchy.DestroySubtree(hierarchy.node, destroyedEntities);
+		m_Registry.destroy(destroyedEntities.begin(), destroyedEntities.end());
+	}
+	void Scene::DefferedDelete(Entity entity)
+	{
+		auto& hierarchy = m_Registry.get<HierarchyComponent>(entity);
+		if (hierarchy.node == TransformHierarchy::InvalidNode) return; //already queued
+		size_t first = deletionQueue.size();
+		transformHierarchy.DestroySubtree(hierarchy.node, deletionQueue);
+		for (size_t i = first; i < deletionQueue.size(); i++)
+			m_Registry.get<HierarchyComponent>(deletionQueue[i]).node = TransformHierarchy::InvalidNode;
+	}
+	Entity Scene::GetRootEntity()
+	{
+		return Entity(root, this);
+	}
+	
+	Entity Scene::GetPrimaryCameraEntity()
+	{
+		PT_PROFILE_FUNCTION();
+		//Primary is a plain field, so the cached camera is rechecked before it's trusted
+		if (!primaryCameraDirty && primaryCamera != entt::null)
+		{
+			const auto* camera = m_Registry.try_get<CameraComponent>(primaryCamera);
+			if (camera && camera->Primary) return Entity(primaryCamera, this);
+		}
+		primaryCamera = entt::null;
+		primaryCameraDirty = false;
+		auto view = m_Registry.view<CameraComponent>();
+		for (auto entity : view)
+		{
+			const auto& camera = view.get<CameraComponent>(entity);
+			if (camera.Primary)
+			{
+				primaryCamera = entity;
+				return Entity(entity, this);
+			}
+		}
+		return Entity();
+	}
+	Entity Scene::GetEntityByUUID(UUID id)
+	{
+		auto it = uuidIndex.find(id);
+		return Entity(it == uuidIndex.end() ? entt::null : it->second, this);
+	}
+	entt::entity Scene::FindByName(std::string_view name)
+	{
+		auto it = tagIndex.find(name);
+		if (it == tagIndex.end()) return entt::null;
+		for (auto entity : it->second)
+			if (m_Registry.get<TagComponent>(entity).Tag == name) return entity;
+		return entt::null;
+	}
+	Entity Scene::GetEntityByName(const std::string& name)
+	{
+		return Entity(FindByName(name), this);
+	}
+	std::vector<Entity> Scene::GetAllEntitesWithName(const std::string& name)
+	{
+		std::vector<Entity> retVal;
+		ForEachEntityWithName(name, [&](Entity e) { retVal.push_back(e); });
+		return retVal;
+	}
+	void Scene::ForEachEntityWithName(std::string_view name, const std::function<void(Entity)>& fn)
+	{
+		auto it = tagIndex.find(name);
+		if (it == tagIndex.end()) return;
+		for (auto entity : it->second)
+			if (m_Registry.get<TagComponent>(entity).Tag == name) fn(Entity(entity, this));
+	}
+	void Scene::RenameEntity(Entity entity, const std::string& name)
+	{
+		m_Registry.patch<TagComponent>(entity, [&](TagComponent& tag) { tag.Tag = name; });
+	}
+	void Scene::OnIDAdded(entt::registry& reg, entt::entity e)
+	{
+		uuidIndex[reg.get<IDComponent>(e).uuid] = e;
+	}
+	void Scene::OnIDUpdated(entt::registry& reg, entt::entity e)
+	{
+		//the old id isn't known anymore, ids are hardly ever changed after creation so a sweep is fine
+		std::erase_if(uuidIndex, [e](const auto& entry) { return entry.second == e; });
+		OnIDAdded(reg, e);
+	}
+	void Scene::OnIDRemoved(entt::registry& reg, entt::entity e)
+	{
+		auto it = uuidIndex.find(reg.get<IDComponent>(e).uuid);
+		if (it != uuidIndex.end() && it->second == e) uuidIndex.erase(it);
+	}
+	void Scene::OnTagAdded(entt::registry& reg, entt::entity e)
+	{
+		auto [it, inserted] = tagIndex.try_emplace(reg.get<TagComponent>(e).Tag);
+		it->second.push_back(e);
+		indexedTags[e] = &it->first;
+	}
+	void Scene::OnTagUpdated(entt::registry& reg, entt::entity e)
+	{
+		OnTagRemoved(reg, e);
+		OnTagAdded(reg, e);
+	}
+	void Scene::OnTagRemoved(entt::registry& reg, entt::entity e)
+	{
+		auto indexed = indexedTags.find(e);
+		if (indexed == indexedTags.end()) return;
+		auto bucket = tagIndex.find(*indexed->second);
+		std::erase(bucket->second, e);
+		if (bucket->second.empty()) tagIndex.erase(bucket);
+		indexedTags.erase(indexed);
+	}
+	void Scene::OnCameraChanged(entt::registry& reg, entt::entity e)
+	{
+		primaryCameraDirty = true;
+	}
+	void Scene::UpdatePassConstants(const Matrix4& view, const SceneCamera& cam, const Vector3& camPos,float delta)
+	{
+		const Matrix4& proj = cam.GetProjection();
+		Matrix4 viewProj = view * proj;
+		XMStoreFloat4x4(&passConstants.View, XMMatrixTranspose(view));
+		XMStoreFloat4x4(&passConstants.Proj, XMMatrixTranspose(proj));
+		XMStoreFloat4x4(&passConstants.ViewProj, XMMatrixTranspose(viewProj));
+		XMStoreFloat4x4(&passConstants.InvProj, XMMatrixTranspose(XMMatrixInverse(nullptr, proj)));
+		XMStoreFloat4x4(&passConstants.InvView, XMMatrixTranspose(XMMatrixInverse(nullptr, view)));
+		XMStoreFloat4x4(&passConstants.InvViewProj, XMMatrixTranspose(XMMatrixInverse(nullptr, viewProj)));
+		passConstants.numClusters = { (float)clustersDim[0],(float)clustersDim[1],(float)clustersDim[2]};
+		passConstants.RenderTargetSize = { (float)sceneResolution[0],(float)sceneResolution[1]};
+		passConstants.NearZ = cam.GetNear();
+		passConstants.FarZ = cam.GetFar();
+		passConstants.InvRenderTargetSize = { 1.f / (float)sceneResolution[0], 1.f / (float)sceneResolution[1]};
+		passConstants.bias = ((float)clustersDim[2] * log10f(passConstants.NearZ)) / (log10f(passConstants.FarZ / passConstants.NearZ));
+		passConstants.scale = (float)clustersDim[2] / (log10f(passConstants.FarZ / passConstants.NearZ));
+		passConstants.numDirectionalRegularLights = numRegularDirLights;
+		passConstants.numDirectionalShadowLights = numShadowDirLights;
+		passConstants.numRegularLights = regularLights.size();
+		passConstants.numShadowLights = shadowLights.size();
+		passConstants.EyePosW = camPos;
+		passConstants.DeltaTime = delta;
+		passCB[RendererBase::GetCurrentFrameIndex()].Update(&passConstants, sizeof(PassConstants), 0);
+	}
+	void Scene::UpdatePassConstants(const EditorCamera& cam, float delta)
+	{
+		const Matrix4& proj = cam.GetProjection();
+		const Matrix4& view = cam.GetViewMatrix();
+		Matrix4 viewProj = cam.GetViewProjection();
+		XMStoreFloat4x4(&passConstants.View, XMMatrixTranspose(view));
+		XMStoreFloat4x4(&passConstants.Proj, XMMatrixTranspose(proj));
+		XMStoreFloat4x4(&passConstants.ViewProj, XMMatrixTranspose(viewProj));
+		XMStoreFloat4x4(&passConstants.InvProj, XMMatrixTranspose(XMMatrixInverse(nullptr, proj)));
+		XMStoreFloat4x4(&passConstants.InvView, XMMatrixTranspose(XMMatrixInverse(nullptr, view)));
+		XMStoreFloat4x4(&passConstants.InvViewProj, XMMatrixTranspose(XMMatrixInverse(nullptr, viewProj)));
+		passConstants.numClusters = { (float)clustersDim[0],(float)clustersDim[1],(float)clustersDim[2] };
+		passConstants.RenderTargetSize = { (float)sceneResolution[0],(float)sceneResolution[1] };
+		passConstants.NearZ = cam.GetNearClip();
+		passConstants.FarZ = cam.GetFarClip();
+		passConstants.InvRenderTargetSize = { 1.f / (float)sceneResolution[0], 1.f / (float)sceneResolution[1] };
+		passConstants.bias = ((float)clustersDim[2] * log10f(passConstants.NearZ)) / (log10f(passConstants.FarZ / passConstants.NearZ));
+		passConstants.scale = (float)clustersDim[2] / (log10f(passConstants.FarZ / passConstants.NearZ));
+		passConstants.numDirectionalRegularLights = numRegularDirLights;
+		passConstants.numDirectionalShadowLights = numShadowDirLights;
+		passConstants.numRegularLights = regularLights.size();
+		passConstants.numShadowLights = shadowLights.size();
+		passConstants.EyePosW = cam.GetPosition();
+		passConstants.DeltaTime = delta;
+		passCB[RendererBase::GetCurrentFrameIndex()].Update(&passConstants, sizeof(PassConstants), 0);
+	}
+	const RenderTexture& Scene::GetFinalRender()
+	{
+		return finalRender;
+	}
+	uint32_t Scene::UpdateTransforms()
+	{
+		PT_PROFILE_FUNCTION();
+		//the storage is fetched up front, lookups into it are safe from the workers
+		auto& transforms = m_Registry.storage<TransformComponent>();
+		auto& hierarchies = m_Registry.storage<HierarchyComponent>();
+		//only the transforms written since the last update, not every transform in the scene
+		for (auto entity : dirtyTransforms)
+		{
+			if (!transforms.contains(entity)) continue;
+			transforms.get(entity).bDirty = false;
+			if (hierarchies.contains(entity)) transformHierarchy.MarkDirty(hierarchies.get(entity).node);
+		}
+		dirtyTransforms.clear();
+		auto& meshes = m_Registry.storage<MeshRendererComponent>();
+		std::atomic<uint32_t> numStaticMoved = 0;
+		uint32_t numUpdated = transformHierarchy.Propagate([&](entt::entity e, DirectX::FXMMATRIX parentTransform)
+			{
+				auto& tc = transforms.get(e);
+				tc.worldSpaceTransform = tc.GetLocalTransform() * parentTransform;
+				//world bounds follow the transform, every mesh owns its slot so this is safe on the workers
+				if (meshes.contains(e))
+				{
+					auto& mesh = meshes.get(e);
+					meshBounds.SetWorld(mesh.boundsSlot, tc.worldSpaceTransform);
+					mesh.bObjectDataDirty = true;
+					if (tc.mobility == TransformComponent::Mobility::Static) numStaticMoved.fetch_add(1, std::memory_order_relaxed);
+				}
+				return tc.worldSpaceTransform;
+			}, GetWorkerPool());
+		//before the shadow casters are culled, so no cached shadow view is reused with a static mesh where it used to be
+		if (numStaticMoved.load()) staticGeometryVersion++;
+		return numUpdated;
+	}
+	void Scene::SyncMeshBounds()
+	{
+		PT_PROFILE_FUNCTION();
+		//only refetches the model box when a mesh was assigned a different model, transforms are handled in UpdateTransforms
+		auto& transforms = m_Registry.storage<TransformComponent>();
+		auto& meshes = m_Registry.storage<MeshRendererComponent>();
+		for (uint32_t slot = 0; slot < meshBounds.Size(); slot++)
+		{
+			entt::entity e = meshBounds.GetEntity(slot);
+			const auto& mesh = meshes.get(e);
+			if (!meshBounds.IsStale(slot, mesh.Model.GetUUID(), mesh.modelIndex)) continue;
+			const auto* model = GetAssetManager()->GetResource<Model>(mesh.Model);
+			if (!model || (uint32_t)mesh.modelIndex >= model->aabbs.size())
+			{
+				//a model that isn't loaded yet stays stale and is retried next frame
+				meshBounds.SetLocal(slot, nullptr, model ? (uint64_t)mesh.Model.GetUUID() : 0, mesh.modelIndex);
+				continue;
+			}
+			meshBounds.SetLocal(slot, &model->aabbs[mesh.modelIndex], mesh.Model.GetUUID(), mesh.modelIndex);
+			if (!transforms.contains(e)) continue;
+			meshBounds.SetWorld(slot, transforms.get(e).worldSpaceTransform);
+			//a static mesh drawn with another model changes the static geometry as much as a move does
+			if (transforms.get(e).mobility == TransformComponent::Mobility::Static) staticGeometryVersion++;
+		}
+		//refit the tree with every box that changed, most moves stay inside the fat box and cost nothing
+		//the gpu scene copy of the box is only rewritten here too, so static meshes never upload their bounds again
+		meshBounds.ConsumeMoved([&](uint32_t slot)
+			{
+				auto& mesh = meshes.get(meshBounds.GetEntity(slot));
+				if (!meshBounds.IsValid(slot))
+				{
+					if (mesh.treeNode != AABBTree::InvalidNode) cullingTree.Remove(mesh.treeNode);
+					mesh.treeNode = AABBTree::InvalidNode;
+					return;
+				}
+				BoundingBox world = meshBounds.GetWorld(slot);
+				gpuScene.SetBounds(mesh.objectID, world);
+				if (mesh.treeNode == AABBTree::InvalidNode) mesh.treeNode = cullingTree.Insert(world, meshBounds.GetEntity(slot), MeshLayer);
+				else cullingTree.Move(mesh.treeNode, world);
+			});
+	}
+	void Scene::SyncLightBounds()
+	{
+		PT_PROFILE_FUNCTION();
+		//light ranges and types are plain fields, lights are few so they are refit every frame
+		auto lights = m_Registry.view<LightComponent, TransformComponent>();
+		for (auto entity : lights)
+		{
+			auto [light, tc] = lights.get(entity);
+			if (light.Type == LightType::Directional)
+			{
+				LightBounds::Remove(cullingTree, light);
+				continue;
+			}
+			BoundingBox box;
+			BoundingBox::CreateFromSphere(box, BoundingSphere(tc.Translation, light.exData.z));
+			LightBounds::Sync(cullingTree, light, entity, box, LightLayer);
+		}
+	}
+	void Scene::CullShadowCasters()
+	{
+		PT_PROFILE_FUNCTION();
+		shadowQueue.Clear();
+		casterLists.assign(shadowLights.size() * 8, CasterList{ 0, 0, 0, 0 });
+		auto& meshes = m_Registry.storage<MeshRendererComponent>();
+		auto& transforms = m_Registry.storage<TransformComponent>();
+		//every light is culled on its own worker, the tree is only read so the queries can run side by side
+		casterScratch.resize(shadowLights.size());
+		//held cascades draw nothing this frame, they aren't queried
+		shadowViewActions.assign(shadowLights.size() * 4, 0);
+		for (uint32_t i = 0; i < shadowLights.size(); i++)
+			for (uint32_t j = 0; j < 4; j++)
+				if (shadowLights[i].light.type == LightType::Directional && GetHeldCascade(shadowLights[i], j)) shadowViewActions[i * 4 + j] = ShadowHeld;
+		ParallelFor(GetWorkerPool(), (uint32_t)shadowLights.size(), 1, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					const auto& light = shadowLights[i];
+					CasterScratch& scratch = casterScratch[i];
+					scratch.nodesVisited = 0;
+					uint32_t numProjections = light.light.type == LightType::Directional ? 4 : light.light.type == LightType::Spot ? 1 : 0;
+					/*
+					* a cascade only bounds its slice of the camera frustum, casters between it and the light still shadow it,
+					* so its near plane is left out and the shadow shader clamps their depth to it instead of clipping them
+					*/
+					bool directional = light.light.type == LightType::Directional;
+					for (uint32_t j = 0; j < 4; j++)
+					{
+						scratch.casters[j].clear();
+						if (j >= numProjections || shadowViewActions[i * 4 + j] == ShadowHeld) continue;
+						//the projections are stored transposed for the shaders
+						DirectX::XMFLOAT4 planes[6];
+						AABBTree::GetPlanes(DirectX::XMMatrixTranspose(DirectX::XMLoadFloat4x4(&light.projection[j])), planes);
+						scratch.nodesVisited += cullingTree.Query(directional ? planes + 1 : planes, directional ? 5 : 6, MeshLayer,
+							[&](entt::entity e, uint32_t) { scratch.casters[j].push_back(e); });
+					}
+				}
+			});
+		//mesh ids are handed out on first use, so the lists are merged into the queue on this thread
+		for (uint32_t i = 0; i < shadowLights.size(); i++)
+		{
+			stats.numCullingNodesVisited += casterScratch[i].nodesVisited;
+			if (shadowLights[i].light.type == LightType::Spot) stats.numSpotCasters += (uint32_t)casterScratch[i].casters[0].size();
+			for (uint32_t j = 0; j < 4; j++)
+			{
+				for (entt::entity e : casterScratch[i].casters[j])
+				{
+					//static and dynamic casters of a view go to neighbouring lists, the static one can be cached
+					bool dynamic = !transforms.contains(e) || transforms.get(e).mobility != TransformComponent::Mobility::Static;
+					uint32_t list = (i * 4 + j) * 2 + dynamic;
+					uint32_t mesh = GetMeshSortID(meshes.get(e));
+					shadowQueue.Push(RenderQueue::ListKey(RenderQueue::Pass::Shadow, list, mesh), e, ((uint64_t)list << 32) | mesh);
+				}
+			}
+		}
+		//casters end up grouped by list then mesh, the batch key holds the exact list so batches never span two lists
+		shadowQueue.Sort();
+		shadowQueue.BuildBatches();
+		std::span<const RenderQueue::Item> items = shadowQueue.GetItems();
+		std::span<const RenderQueue::Batch> batches = shadowQueue.GetBatches();
+		for (uint32_t b = 0; b < batches.size(); b++)
+		{
+			CasterList& list = casterLists[items[batches[b].first].batch >> 32];
+			if (list.numBatches == 0)
+			{
+				list.offset = batches[b].first;
+				list.firstBatch = b;
+			}
+			list.count += batches[b].count;
+			list.numBatches++;
+		}
+		for (uint32_t i = 0; i < shadowLights.size(); i++)
+		{
+			if (shadowLights[i].light.type != LightType::Directional) continue;
+			for (uint32_t j = 0; j < 4; j++) stats.numCascadeCasters[j] += casterLists[(i * 4 + j) * 2].count + casterLists[(i * 4 + j) * 2 + 1].count;
+		}
+		UpdateShadowCache();
+		if (singlePassCascades) BuildCascadeLists();
+	}
+	RHI::Area2D Scene::GetShadowViewArea(const ShadowCastingLight& light, uint32_t cascade)
+	{
+		if (light.light.type != LightType::Directional)
+			return { { (int)light.shadowMap.offset.x, (int)light.shadowMap.offset.y }, { light.shadowMap.size.x, light.shadowMap.size.y } };
+		//cascades split the light's region in quarters, left to right then top to bottom
+		uint32_t width = light.shadowMap.size.x / 2;
+		uint32_t height = light.shadowMap.size.y / 2;
+		return { { (int)(light.shadowMap.offset.x + (cascade & 1) * width), (int)(light.shadowMap.offset.y + (cascade >> 1) * height) }, { width, height } };
+	}
+	uint64_t Scene::GetShadowViewKey(const RHI::Area2D& area)
+	{
+		//the atlas rectangle identifies the view, lights keep their region for as long as they stay visible
+		return (uint64_t)area.offset.x | ((uint64_t)area.offset.y << 16) | ((uint64_t)area.size.width << 32) | ((uint64_t)area.size.height << 48);
+	}
+	const Scene::ShadowViewCache* Scene::GetHeldCascade(const ShadowCastingLight& light, uint32_t cascade) const
+	{
+		uint32_t interval = cascadeUpdateInterval[cascade];
+		if ((shadowFrame + interval - cascadePhase[cascade]) % interval == 0) return nullptr;
+		//a cascade that was never drawn at this place has nothing to hold
+		auto it = shadowViewCache.find(GetShadowViewKey(GetShadowViewArea(light, cascade)));
+		return it == shadowViewCache.end() ? nullptr : &it->second;
+	}
+	void Scene::ScheduleCascadeUpdates(const uint32_t* intervals)
+	{
+		uint32_t period = 1;
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			cascadeUpdateInterval[i] = std::clamp(intervals[i], 1u, 8u);
+			period = std::lcm(period, cascadeUpdateInterval[i]);
+		}
+		//every cascade takes the phase whose busiest frame has the fewest updates so far, 1, 2, 4, 4 ends up drawing 2 cascades every frame
+		std::vector<uint32_t> load(period, 0);
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			uint32_t interval = cascadeUpdateInterval[i];
+			uint32_t best = 0, bestLoad = UINT32_MAX;
+			for (uint32_t phase = 0; phase < interval; phase++)
+			{
+				uint32_t busiest = 0;
+				for (uint32_t frame = phase; frame < period; frame += interval) busiest = std::max(busiest, load[frame]);
+				if (busiest < bestLoad) { bestLoad = busiest; best = phase; }
+			}
+			cascadePhase[i] = best;
+			for (uint32_t frame = best; frame < period; frame += interval) load[frame]++;
+		}
+	}
+	void Scene::BuildCascadeLists()
+	{
+		PT_PROFILE_FUNCTION();
+		cascadeQueue.Clear();
+		cascadeLists.assign(shadowLights.size() * 2, CasterList{ 0, 0, 0, 0 });
+		std::span<const RenderQueue::Item> shadowItems = shadowQueue.GetItems();
+		for (uint32_t i = 0; i < shadowLights.size(); i++)
+		{
+			if (shadowLights[i].light.type != LightType::Directional) continue;
+			for (uint32_t j = 0; j < 4; j++)
+			{
+				uint8_t actions = shadowViewActions[i * 4 + j];
+				for (uint32_t dynamic = 0; dynamic < 2; dynamic++)
+				{
+					//a cascade's static casters only go out when its cache is redrawn
+					if (!(actions & (dynamic ? ShadowDrawDynamic : ShadowRenderStatic))) continue;
+					const CasterList& casters = casterLists[(i * 4 + j) * 2 + dynamic];
+					uint32_t list = i * 2 + dynamic;
+					for (uint32_t c = 0; c < casters.count; c++)
+					{
+						const RenderQueue::Item& item = shadowItems[casters.offset + c];
+						uint32_t mesh = (uint32_t)item.batch;
+						cascadeQueue.Push(RenderQueue::ListSubKey(RenderQueue::Pass::Shadow, list, mesh, j), item.entity, ((uint64_t)list << 32) | mesh);
+					}
+				}
+			}
+		}
+		//one batch per mesh and list whatever the number of cascades it touches
+		cascadeQueue.Sort();
+		cascadeQueue.BuildBatches();
+		std::span<const RenderQueue::Item> items = cascadeQueue.GetItems();
+		std::span<const RenderQueue::Batch> batches = cascadeQueue.GetBatches();
+		for (uint32_t b = 0; b < batches.size(); b++)
+		{
+			CasterList& list = cascadeLists[items[batches[b].first].batch >> 32];
+			if (list.numBatches == 0)
+			{
+				list.offset = batches[b].first;
+				list.firstBatch = b;
+			}
+			list.count += batches[b].count;
+			list.numBatches++;
+		}
+		stats.numCascadeInstances += cascadeQueue.Size();
+	}
+	void Scene::DrawCascades(RHI::Weak<RHI::GraphicsCommandList> list, RHI::RenderingAttachmentDesc& attachDesc, uint32_t index, uint32_t dynamic)
+	{
+		const auto& light = shadowLights[index];
+		RHI::RenderingBeginDesc rbDesc{};
+		rbDesc.pDepthStencilAttachment = &attachDesc;
+		//the cascades whose static depth is redrawn are cleared on their own, the casters then go out over the whole region
+		if (!dynamic)
+		{
+			attachDesc.loadOp = RHI::LoadOp::Clear;
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				if (!(shadowViewActions[index * 4 + i] & ShadowRenderStatic)) continue;
+				rbDesc.renderingArea = GetShadowViewArea(light, i);
+				list->BeginRendering(rbDesc);
+				list->EndRendering();
+			}
+		}
+		const CasterList& casters = cascadeLists[index * 2 + dynamic];
+		if (!casters.numBatches) return;
+		RHI::Area2D rect = { { (int)light.shadowMap.offset.x, (int)light.shadowMap.offset.y }, { light.shadowMap.size.x, light.shadowMap.size.y } };
+		RHI::Viewport vp;
+		vp.x = (float)rect.offset.x; vp.y = (float)rect.offset.y;
+		vp.width = (float)rect.size.width; vp.height = (float)rect.size.height;
+		vp.minDepth = 0; vp.maxDepth = 1;
+		Shader* shd = Renderer::GetBuiltinShader("Cascaded Shadow Shader");
+		shd->Bind(list);
+		shd->ApplyBinding(list, shadowSetInfo);
+		shd->ApplyBinding(list, objectInfoGFX[RendererBase::GetCurrentFrameIndex()]);
+		list->SetViewports(1, &vp);
+		list->SetScissorRects(1, &rect);
+		uint32_t baseOffset = (regularLights.size() * sizeof(RegularLight)) / (sizeof(float) * 4);
+		uint32_t offsetMul = sizeof(ShadowCastingLight) / (sizeof(float) * 4);
+		uint32_t constants[3] = { baseOffset + (index * offsetMul), 0, 0 };
+		attachDesc.loadOp = RHI::LoadOp::Load;
+		rbDesc.renderingArea = rect;
+		list->BeginRendering(rbDesc);
+		SubmitRecords(list, drawArgs.GetBuffer(RendererBase::GetCurrentFrameIndex()), cascadeDrawBase + casters.firstBatch, casters.numBatches, constants, 3);
+		(dynamic ? stats.numShadowDraws : stats.numStaticShadowDraws) += casters.numBatches;
+		stats.numShadowDrawCalls++;
+		list->EndRendering();
+	}
+	void Scene::SubmitRecords(RHI::Weak<RHI::GraphicsCommandList> list, RHI::Ptr<RHI::Buffer> args, uint32_t firstRecord, uint32_t numRecords,
+		uint32_t* constants, uint32_t numConstants)
+	{
+		if (!numRecords) return;
+		constants[numConstants - 1] = firstRecord;
+		list->PushConstants(1, numConstants, constants, 0);
+		Renderer::SubmitIndirect(list, args, IndirectDrawBuffer::GetOffset(firstRecord), numRecords);
+	}
+	void Scene::UpdateShadowCache()
+	{
+		PT_PROFILE_FUNCTION();
+		std::span<const RenderQueue::Item> items = shadowQueue.GetItems();
+		for (uint32_t i = 0; i < shadowLights.size(); i++)
+		{
+			const auto& light = shadowLights[i];
+			uint32_t numViews = light.light.type == LightType::Directional ? 4 : light.light.type == LightType::Spot ? 1 : 0;
+			for (uint32_t j = 0; j < numViews; j++)
+			{
+				uint32_t view = i * 4 + j;
+				uint64_t key = GetShadowViewKey(GetShadowViewArea(light, j));
+				//a held cascade keeps its depth and its cache entry as they are, changes are picked up on its next update
+				if (shadowViewActions[view] == ShadowHeld)
+				{
+					shadowViewCache[key].lastFrame = shadowFrame;
+					shadowViewActions[view] = 0;
+					stats.numShadowViewsReused++;
+					stats.numShadowViewsHeld++;
+					continue;
+				}
+				const CasterList& staticCasters = casterLists[view * 2];
+				uint64_t signature = staticCasters.count;
+				for (uint32_t c = 0; c < staticCasters.count; c++)
+					signature = signature * 0x100000001b3ull ^ (uint64_t)entt::to_integral(items[staticCasters.offset + c].entity);
+				auto [it, added] = shadowViewCache.try_emplace(key);
+				ShadowViewCache& cache = it->second;
+				bool staticValid = !added && cache.staticVersion == staticGeometryVersion && cache.staticCasters == signature &&
+					memcmp(&cache.projection, &light.projection[j], sizeof(cache.projection)) == 0;
+				bool dynamic = casterLists[view * 2 + 1].count != 0;
+				uint8_t actions = 0;
+				if (!staticValid) actions |= ShadowRenderStatic;
+				//the atlas still holds last frame's dynamic casters, the static depth is copied back over them
+				if (!staticValid || dynamic || cache.hadDynamic) actions |= ShadowCopyStatic;
+				if (dynamic) actions |= ShadowDrawDynamic;
+				shadowViewActions[view] = actions;
+				if (actions) stats.numShadowViewsRendered++;
+				else stats.numShadowViewsReused++;
+				cache.projection = light.projection[j];
+				cache.staticCasters = signature;
+				cache.staticVersion = staticGeometryVersion;
+				cache.hadDynamic = dynamic;
+				cache.lastFrame = shadowFrame;
+			}
+		}
+		//views that weren't drawn this frame lost their region or may have had it overwritten
+		std::erase_if(shadowViewCache, [this](const auto& entry) { return entry.second.lastFrame != shadowFrame; });
+	}
+	void Scene::OnMeshRendererAdded(entt::registry& reg, entt::entity e)
+	{
+		auto& mesh = reg.get<MeshRendererComponent>(e);
+		mesh.objectID = gpuScene.Allocate();
+		TransformData td;
+		td.transform = Matrix4::Identity;
+		td.normal = Matrix4::Identity;
+		gpuScene.Set(mesh.objectID, td);
+	}
+	void Scene::OnMeshRendererRemoved(entt::registry& reg, entt::entity e)
+	{
+		gpuScene.Free(reg.get<MeshRendererComponent>(e).objectID);
+	}
+	void Scene::OnTransformAdded(entt::registry& reg, entt::entity e)
+	{
+		auto& transform = reg.get<TransformComponent>(e);
+		transform.entity = e;
+		transform.dirtyList = &dirtyTransforms;
+		transform.bDirty = false;
+		transform.MarkDirty();
+	}
+	void Scene::OnMeshBoundsAdded(entt::registry& reg, entt::entity e)
+	{
+		auto& mesh = reg.get<MeshRendererComponent>(e);
+		mesh.boundsSlot = meshBounds.Add(e);
+		mesh.treeNode = AABBTree::InvalidNode;
+		//the fresh gpu scene slot holds an identity transform
+		mesh.bObjectDataDirty = true;
+	}
+	void Scene::OnMeshBoundsRemoved(entt::registry& reg, entt::entity e)
+	{
+		auto& mesh = reg.get<MeshRendererComponent>(e);
+		if (mesh.treeNode != AABBTree::InvalidNode) cullingTree.Remove(mesh.treeNode);
+		entt::entity moved = meshBounds.Remove(mesh.boundsSlot);
+		if (moved != entt::null) reg.get<MeshRendererComponent>(moved).boundsSlot = mesh.boundsSlot;
+		const auto* transform = reg.try_get<TransformComponent>(e);
+		if (transform && transform->mobility == TransformComponent::Mobility::Static) staticGeometryVersion++;
+	}
+	void Scene::OnLightAdded(entt::registry& reg, entt::entity e)
+	{
+		LightBounds::Reset(reg.get<LightComponent>(e));
+	}
+	void Scene::OnLightRemoved(entt::registry& reg, entt::entity e)
+	{
+		LightBounds::Remove(cullingTree, reg.get<LightComponent>(e));
+	}
+	ThreadPool* Scene::GetWorkerPool() const
+	{
+		if (!multithreaded || !Application::Exists()) return nullptr;
+		return &Application::Get().GetWorkerPool();
+	}
+	float Scene::RaycastTriangles(entt::entity entity, const Ray& ray, float maxDistance) const
+	{
+		using namespace DirectX;
+		const auto& meshc = m_Registry.get<MeshRendererComponent>(entity);
+		const auto* model = GetAssetManager()->GetResource<Model>(meshc.Model);
+		if (!model) return -1.f;
+		const Mesh& mesh = model->meshes[meshc.modelIndex];
+		const XMMATRIX& world = m_Registry.get<TransformComponent>(entity).worldSpaceTransform;
+		//the ray is moved into model space instead of moving every vertex out of it
+		XMMATRIX invWorld = XMMatrixInverse(nullptr, world);
+		XMVECTOR origin = XMVector3Transform(ray.position, invWorld);
+		XMVECTOR direction = XMVector3Normalize(XMVector3TransformNormal(ray.direction, invWorld));
+		const auto& vertices = mesh.GetVertices();
+		const auto& indices = mesh.GetIndices();
+		float closest = FLT_MAX;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			XMVECTOR v0 = XMLoadFloat3((const XMFLOAT3*)&vertices[indices[i]].position);
+			XMVECTOR v1 = XMLoadFloat3((const XMFLOAT3*)&vertices[indices[i + 1]].position);
+			XMVECTOR v2 = XMLoadFloat3((const XMFLOAT3*)&vertices[indices[i + 2]].position);
+			float t;
+			if (TriangleTests::Intersects(origin, direction, v0, v1, v2, t)) closest = std::min(closest, t);
+		}
+		if (closest == FLT_MAX) return -1.f;
+		//model space distances are scaled, so measure the hit again in world space
+		XMVECTOR hit = XMVector3Transform(XMVectorMultiplyAdd(direction, XMVectorReplicate(closest), origin), world);
+		float distance = XMVectorGetX(XMVector3Length(XMVectorSubtract(hit, ray.position)));
+		return distance <= maxDistance ? distance : -1.f;
+	}
+	template<typename Test>
+	bool Scene::OverlapTriangles(entt::entity entity, Test&& test) const
+	{
+		using namespace DirectX;
+		const auto& meshc = m_Registry.get<MeshRendererComponent>(entity);
+		const auto* model = GetAssetManager()->GetResource<Model>(meshc.Model);
+		if (!model) return false;
+		const Mesh& mesh = model->meshes[meshc.modelIndex];
+		const XMMATRIX& world = m_Registry.get<TransformComponent>(entity).worldSpaceTransform;
+		const auto& vertices = mesh.GetVertices();
+		const auto& indices = mesh.GetIndices();
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			XMVECTOR v0 = XMVector3Transform(XMLoadFloat3((const XMFLOAT3*)&vertices[indices[i]].position), world);
+			XMVECTOR v1 = XMVector3Transform(XMLoadFloat3((const XMFLOAT3*)&vertices[indices[i + 1]].position), world);
+			XMVECTOR v2 = XMVector3Transform(XMLoadFloat3((const XMFLOAT3*)&vertices[indices[i + 2]].position), world);
+			if (test(v0, v1, v2)) return true;
+		}
+		return false;
+	}
+	bool Scene::Raycast(const Ray& ray, float maxDistance, RaycastHit& hit, QueryPrecision precision) const
+	{
+		PT_PROFILE_FUNCTION();
+		hit.entity = entt::null;
+		cullingTree.Raycast(ray.position, ray.direction, maxDistance, MeshLayer, [&](entt::entity e, float boxDistance)
+			{
+				//the tree already clips boxes further than the closest hit so far
+				float distance = precision == QueryPrecision::Bounds ? boxDistance : RaycastTriangles(e, ray, maxDistance);
+				if (distance < 0.f) return maxDistance;
+				hit.entity = e;
+				hit.distance = maxDistance = distance;
+				return maxDistance;
+			});
+		if (hit.entity == entt::null) return false;
+		hit.position = ray.position + ray.direction * hit.distance;
+		return true;
+	}
+	void Scene::RaycastBatch(std::span<const Ray> rays, float maxDistance, std::span<RaycastHit> hits, QueryPrecision precision)
+	{
+		PT_PROFILE_FUNCTION();
+		PT_CORE_ASSERT(hits.size() >= rays.size());
+		//queries only read the tree, so the rays can be split freely
+		ParallelFor(GetWorkerPool(), (uint32_t)rays.size(), 64, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++) Raycast(rays[i], maxDistance, hits[i], precision);
+			});
+	}
+	template<typename Volume>
+	void Scene::Overlap(const Volume& volume, std::vector<Entity>& out, QueryPrecision precision)
+	{
+		cullingTree.QueryOverlap([&](const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max)
+			{
+				BoundingBox box;
+				BoundingBox::CreateFromPoints(box, DirectX::XMLoadFloat3(&min), DirectX::XMLoadFloat3(&max));
+				return volume.Intersects(box);
+			}, MeshLayer, [&](entt::entity e, uint32_t)
+			{
+				if (precision == QueryPrecision::Triangles &&
+					!OverlapTriangles(e, [&](DirectX::FXMVECTOR v0, DirectX::FXMVECTOR v1, DirectX::FXMVECTOR v2) { return volume.Intersects(v0, v1, v2); }))
+					return;
+				out.emplace_back(e, this);
+			});
+	}
+	void Scene::OverlapSphere(const BoundingSphere& sphere, std::vector<Entity>& out, QueryPrecision precision)
+	{
+		PT_PROFILE_FUNCTION();
+		Overlap(sphere, out, precision);
+	}
+	void Scene::OverlapBox(const BoundingBox& box, std::vector<Entity>& out, QueryPrecision precision)
+	{
+		PT_PROFILE_FUNCTION();
+		Overlap(box, out, precision);
+	}
+	Entity Scene::FindNearest(const Vector3& point, float maxDistance)
+	{
+		PT_PROFILE_FUNCTION();
+		return Entity(cullingTree.FindNearest(point, maxDistance, MeshLayer), this);
+	}
+	void Scene::OnUpdateEditor(float delta, EditorCamera& camera)
+	{
+		PT_PROFILE_FUNCTION();
+		meshesToDraw.clear();
+		shadowLights.clear();
+		regularLights.clear();
+		numShadowDirLights = 0;
+		numRegularDirLights = 0;
+		stats = SceneStatistics{};
+		stats.numTransformsUpdated = UpdateTransforms();
+		FrustumCull(camera.GetViewMatrix(), camera.GetProjection(),Math::ToRadians(camera.GetFOVdeg()),camera.GetNearClip(), camera.GetFarClip(), camera.GetAspectRatio());
+		BuildRenderQueues(camera.GetViewMatrix(), camera.GetNearClip(), camera.GetFarClip());
+		UploadDrawData();
+		UpdateObjectCBs();
+		UpdatePassConstants(camera, delta);
+		UpdateLightsBuffer();
+		ReadBackLightIndices();
+		
+		graph.Execute();
+		graph.SubmitToQueue();
+		depthPyramidValid = true;
+		RHI::SubResourceRange range;
+		range.FirstArraySlice = 0;
+		range.imageAspect = RHI::Aspect::COLOR_BIT;
+		range.IndexOrFirstMipLevel = 0;
+		range.NumArraySlices = 1;
+		range.NumMipLevels = 1;
+		RHI::TextureMemoryBarrier barr[1];
+		barr[0].AccessFlagsBefore = RHI::ResourceAcessFlags::NONE;
+		barr[0].AccessFlagsAfter = RHI::ResourceAcessFlags::NONE;
+		barr[0].newLayout = RHI::ResourceLayout::GENERAL;
+		barr[0].nextQueue = barr[0].previousQueue = RHI::QueueFamily::Ignored;
+		barr[0].oldLayout = RHI::ResourceLayout::COLOR_ATTACHMENT_OPTIMAL;
+		barr[0].texture = finalRender.GetID();
+		barr[0].subresourceRange = range;
+
+		RendererBase::GetMainCommandList()->PipelineBarrier(RHI::PipelineStage::COLOR_ATTACHMENT_OUTPUT_BIT,
+			RHI::PipelineStage::TRANSFER_BIT, {}, {barr,1});
+
+		//notify render graph of layout change
+		finalRenderTex.originVector->at(finalRenderTex.offset).current_layout = RHI::ResourceLayout::GENERAL;
+		m_Registry.destroy(deletionQueue.begin(), deletionQueue.end());
+		deletionQueue.clear();
+	}
+	void Scene::OnUpdateRuntime(float delta)
+	{
+
+	}
+	void Scene::OnViewportResize(unsigned int width, unsigned int height)
+	{
+		PT_PROFILE_FUNCTION();
+		//m_viewportWidth  = width;
+		//m_ViewportHeight = height;
+		auto view = m_Registry.view<CameraComponent>();
+		for (auto entity : view)
+		{
+			auto& camera = view.get<CameraComponent>(entity);
+			if (!camera.FixedAspectRatio)
+			{
+				camera.camera.SetViewportSize(width, height);
+			}
+		}
+	}
+	void Scene::UpdateObjectCBs()
+	{
+		PT_PROFILE_FUNCTION();
+		auto view = m_Registry.view<TransformComponent, MeshRendererComponent>();
+		//only meshes whose world transform changed since their last upload are recomputed
+		objectEntities.clear();
+		uint32_t numObjects = 0;
+		for (auto entity : view)
+		{
+			numObjects++;
+			if (view.get<MeshRendererComponent>(entity).bObjectDataDirty) objectEntities.push_back(entity);
+		}
+		stats.numObjectsSkipped = numObjects - (uint32_t)objectEntities.size();
+		objectData.resize(objectEntities.size());
+		//the matrix math is split across the workers, every entity writes its own slot
+		ParallelFor(GetWorkerPool(), (uint32_t)objectEntities.size(), 512, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					auto& transform = view.get<TransformComponent>(objectEntities[i]);
+					DirectX::XMStoreFloat4x4(&objectData[i].transform, DirectX::XMMatrixTranspose(transform.worldSpaceTransform));
+					DirectX::XMStoreFloat4x4(&objectData[i].normal, DirectX::XMMatrixInverse(nullptr, transform.worldSpaceTransform));
+				}
+			});
+		//the gpu scene only keeps a cpu copy here and marks the slot dirty for every frame in flight, so clearing the mesh's flag
+		//can't leave another frame's buffer stale, each frame's bit is cleared by that frame's upload below
+		uint32_t numStatic = 0;
+		for (uint32_t i = 0; i < objectEntities.size(); i++)
+		{
+			auto [transform, mesh] = view.get(objectEntities[i]);
+			gpuScene.Set(mesh.objectID, objectData[i]);
+			mesh.bObjectDataDirty = false;
+			numStatic += transform.mobility == TransformComponent::Mobility::Static;
+		}
+		stats.numObjectUploads = (uint32_t)objectEntities.size();
+		stats.numStaticObjectUploads = numStatic;
+		//a change is queued for every frame in flight, so frames with nothing new can still have copies to make
+		GPUScene::UploadStats upload = gpuScene.Upload(RendererBase::GetCurrentFrameIndex());
+		stats.numGPUSceneCopies = upload.numCopies;
+		stats.numGPUSceneBytes = upload.numBytes;
+	}
+	void Scene::BuildRenderQueues(const Matrix4& view, float nearClip, float farClip)
+	{
+		PT_PROFILE_FUNCTION();
+		prepassQueue.Clear();
+		opaqueQueue.Clear();
+		AssetManager* assetMan = GetAssetManager();
+		auto& meshes = m_Registry.storage<MeshRendererComponent>();
+		for (auto entity : meshesToDraw)
+		{
+			const auto& meshc = meshes.get(entity);
+			//depth of the bounds center, every visible mesh has valid bounds
+			DirectX::XMVECTOR center = DirectX::XMLoadFloat3(&meshBounds.GetWorld(meshc.boundsSlot).Center);
+			float viewDepth = DirectX::XMVectorGetZ(DirectX::XMVector3Transform(center, view));
+			uint32_t depth = RenderQueue::QuantizeDepth(viewDepth, nearClip, farClip);
+			uint32_t mesh = GetMeshSortID(meshc);
+			const auto* mtl = assetMan->GetResource<Material>(meshc.material);
+			uint32_t shader = mtl ? shaderIDs.Get(mtl->GetShader().GetUUID()) : 0;
+			uint32_t material = materialIDs.Get(meshc.material.GetUUID());
+			//the prepass only binds the mesh, the forward pass also binds the material
+			prepassQueue.Push(RenderQueue::MeshKey(RenderQueue::Pass::ZPrepass, mesh, depth), entity, mesh);
+			opaqueQueue.Push(RenderQueue::StateKey(RenderQueue::Pass::Opaque, shader, material, mesh, depth), entity, ((uint64_t)material << 32) | mesh);
+		}
+		prepassQueue.Sort();
+		opaqueQueue.Sort();
+		prepassQueue.BuildBatches();
+		opaqueQueue.BuildBatches();
+	}
+	uint32_t Scene::GetMeshSortID(const MeshRendererComponent& meshc)
+	{
+		return meshIDs.Get((uint64_t)meshc.Model.GetUUID() ^ ((uint64_t)meshc.modelIndex << 48));
+	}
+	void Scene::UploadDrawData()
+	{
+		PT_PROFILE_FUNCTION();
+		auto& meshes = m_Registry.storage<MeshRendererComponent>();
+		AssetManager* assetMan = GetAssetManager();
+		instanceObjects.clear();
+		drawArgs.Clear();
+		//every batch is one indirect record, its instances are the queue's items from the queue's first instance on
+		auto append = [&](const RenderQueue& queue, uint32_t& drawBase, uint32_t& numInstances, bool cascades = false)
+			{
+				uint32_t instanceBase = (uint32_t)instanceObjects.size();
+				drawBase = drawArgs.Size();
+				for (const auto& item : queue.GetItems())
+				{
+					uint32_t object = meshes.get(item.entity).objectID;
+					//cascade items carry their cascade in the low bits of the key, the shader reads it from the top of the id
+					if (cascades) object |= (uint32_t)(item.key & 3) << CASCADE_INSTANCE_SHIFT;
+					instanceObjects.push_back(object);
+				}
+				std::span<const RenderQueue::Item> items = queue.GetItems();
+				for (const auto& batch : queue.GetBatches())
+				{
+					const auto& meshc = meshes.get(items[batch.first].entity);
+					const Model* model = assetMan->GetResource<Model>(meshc.Model);
+					//records keep their batch's index, a mesh that can't be drawn gets an empty one
+					if (!model)
+					{
+						drawArgs.Push(DrawIndexedArgs{ 0, 0, 0, 0, 0 }, instanceBase + batch.first);
+						continue;
+					}
+					const Mesh& mesh = model->meshes[meshc.modelIndex];
+					drawArgs.Push(Renderer::GetDrawArgs(mesh.GetVBHandle(), mesh.GetIBHandle(), sizeof(Vertex), batch.count), instanceBase + batch.first);
+					numInstances += batch.count;
+				}
+			};
+		uint32_t prepassDrawBase;
+		append(prepassQueue, prepassDrawBase, stats.numInstances);
+		append(opaqueQueue, opaqueDrawBase, stats.numInstances);
+		shadowInstanceBase = (uint32_t)instanceObjects.size();
+		append(shadowQueue, shadowDrawBase, stats.numShadowInstances);
+		append(cascadeQueue, cascadeDrawBase, stats.numShadowInstances, true);
+
+		uint32_t frame = RendererBase::GetCurrentFrameIndex();
+		uint32_t requiredSize = (uint32_t)(instanceObjects.size() * sizeof(uint32_t));
+		bool rebind = gpuScene.GetBufferSize() != boundObjectBufferSize[frame];
+		if (requiredSize > instanceBufferSize[frame])
+		{
+			//only this frame's buffer is replaced, the gpu is done with it
+			instanceBufferSize[frame] = std::max(requiredSize, instanceBufferSize[frame] * 2);
+			instanceBuffer[frame].CreateStack(nullptr, instanceBufferSize[frame], SBCreateFlags::AllowCPUAccess);
+			rebind = true;
+		}
+		drawArgs.Upload(frame);
+		//the records carry the instance bases the vertex shaders read, a frame that never had one has no buffer and draws nothing
+		uint32_t argsSize = drawArgs.GetBufferSize(frame);
+		if (rebind || argsSize != boundRecordsSize[frame])
+		{
+			for (ResourceSet* set : { &objectInfoGFX[frame], &objectInfoVS_PS[frame] })
+			{
+				set->UpdateBufferBinding(gpuScene.GetBuffer(frame), 0, gpuScene.GetBufferSize(), RHI::DescriptorType::StructuredBuffer, 0);
+				set->UpdateBufferBinding(instanceBuffer[frame].GetID(), 0, instanceBufferSize[frame], RHI::DescriptorType::StructuredBuffer, 1);
+				if (argsSize) set->UpdateBufferBinding(drawArgs.GetBuffer(frame), 0, argsSize, RHI::DescriptorType::StructuredBuffer, 2);
+			}
+			boundObjectBufferSize[frame] = gpuScene.GetBufferSize();
+			boundRecordsSize[frame] = argsSize;
+		}
+		if (requiredSize) instanceBuffer[frame].Update(instanceObjects.data(), requiredSize, 0);
+		if (!gpuCulling) return;
+		//the prepass and opaque records are culled, their instances end where the shadow instances start
+		ReserveCulledBuffers(shadowDrawBase, shadowInstanceBase);
+		if (rebind || argsSize != boundDrawArgsSize[frame])
+		{
+			ResourceSet& cull = gpuCullInfo[frame];
+			cull.UpdateBufferBinding(gpuScene.GetBuffer(frame), 0, gpuScene.GetBufferSize(), RHI::DescriptorType::StructuredBuffer, 1);
+			cull.UpdateBufferBinding(instanceBuffer[frame].GetID(), 0, instanceBufferSize[frame], RHI::DescriptorType::StructuredBuffer, 2);
+			//a frame that never had a record has no buffer yet, it doesn't dispatch either
+			if (argsSize) cull.UpdateBufferBinding(drawArgs.GetBuffer(frame), 0, argsSize, RHI::DescriptorType::StructuredBuffer, 3);
+			cull.UpdateBufferBinding(culledArgs.GetID(), 0, culledArgsCapacity * IndirectDrawBuffer::Stride, RHI::DescriptorType::CSBuffer, 4);
+			cull.UpdateBufferBinding(culledInstances.GetID(), 0, culledInstancesCapacity * sizeof(uint32_t), RHI::DescriptorType::CSBuffer, 5);
+			for (ResourceSet* set : { &culledObjectInfoGFX[frame], &culledObjectInfoVS_PS[frame] })
+			{
+				set->UpdateBufferBinding(gpuScene.GetBuffer(frame), 0, gpuScene.GetBufferSize(), RHI::DescriptorType::StructuredBuffer, 0);
+				set->UpdateBufferBinding(culledInstances.GetID(), 0, culledInstancesCapacity * sizeof(uint32_t), RHI::DescriptorType::StructuredBuffer, 1);
+				//culling keeps every record's instance base, so the draws read it from the candidate records
+				if (argsSize) set->UpdateBufferBinding(drawArgs.GetBuffer(frame), 0, argsSize, RHI::DescriptorType::StructuredBuffer, 2);
+			}
+			boundDrawArgsSize[frame] = argsSize;
+		}
+		GPUCullConstants constants{};
+		constants.numRecords = shadowDrawBase;
+		//the pass runs before this frame's prepass, so it tests against last frame's pyramid with the camera that built it,
+		//passConstants is only updated for this frame after the draw data
+		constants.occlusion = depthPyramidValid;
+		constants.pyramidViewProj = passConstants.ViewProj;
+		constants.pyramidSize[0] = depthPyramid.GetWidth(0);
+		constants.pyramidSize[1] = depthPyramid.GetHeight(0);
+		constants.pyramidMips = depthPyramid.GetNumMips();
+		gpuCullCB[frame].Update(&constants, sizeof(constants), 0);
+		stats.numGPUCullRecords = shadowDrawBase;
+	}
+	void Scene::ReserveCulledBuffers(uint32_t numRecords, uint32_t numInstances)
+	{
+		if (numRecords <= culledArgsCapacity && numInstances <= culledInstancesCapacity) return;
+		PT_PROFILE_FUNCTION();
+		//the culled buffers are shared by every frame in flight, so the gpu can't be reading any of them
+		RendererBase::Get().mainFence->Wait(RendererBase::Get().currentFenceVal);
+		if (numRecords > culledArgsCapacity)
+		{
+			culledArgsCapacity = std::max(numRecords, culledArgsCapacity * 2);
+			culledArgs.CreateStack(nullptr, culledArgsCapacity * IndirectDrawBuffer::Stride, SBCreateFlags::IndirectArgs);
+			graph.ReplaceBuffer(culledArgsHandle, culledArgs.GetID(), culledArgsCapacity * IndirectDrawBuffer::Stride);
+		}
+		if (numInstances > culledInstancesCapacity)
+		{
+			culledInstancesCapacity = std::max(numInstances, culledInstancesCapacity * 2);
+			culledInstances.CreateStack(nullptr, culledInstancesCapacity * sizeof(uint32_t));
+			graph.ReplaceBuffer(culledInstancesHandle, culledInstances.GetID(), culledInstancesCapacity * sizeof(uint32_t));
+		}
+		//every frame's sets still point at the old buffers
+		for (uint32_t& size : boundDrawArgsSize) size = UINT32_MAX;
+	}
+	void Scene::ReserveLightList(uint32_t size)
+	{
+		if (size <= lightListSize) return;
+		PT_PROFILE_FUNCTION();
+		//the light list is shared by every frame in flight, so the gpu can't be reading it
+		RendererBase::Get().mainFence->Wait(RendererBase::Get().currentFenceVal);
+		lightListSize = std::max(size, lightListSize * 2);
+		lightList.CreateStack(nullptr, lightListSize, SBCreateFlags::AllowCPUAccess);
+		graph.ReplaceBuffer(lightListHandle, lightList.GetID(), lightListSize);
+		sceneInfo.UpdateBufferBinding(lightList.GetID(), 0, lightListSize, RHI::DescriptorType::StructuredBuffer, 5);
+		shadowSetInfo.UpdateBufferBinding(lightList.GetID(), 0, lightListSize, RHI::DescriptorType::StructuredBuffer, 0);
+		cullLightsInfo.UpdateBufferBinding(lightList.GetID(), 0, lightListSize, RHI::DescriptorType::StructuredBuffer, 2);
+		stats.numLightListGrowths++;
+	}
+	void Scene::ReadBackLightIndices()
+	{
+		PT_PROFILE_FUNCTION();
+		//the frame's fence was waited on, so its readback holds what light culling asked for the last time this frame index ran
+		auto& readback = lightIndexReadback[RendererBase::GetCurrentFrameIndex()];
+		uint32_t* counters = static_cast<uint32_t*>(readback.GetID()->Map().value());
+		uint32_t required = counters[0];
+		uint32_t maxClusterLights = counters[1];
+		counters[0] = counters[1] = 0;
+		readback.GetID()->UnMap();
+		stats.numLightIndices = required;
+		stats.lightIndexCapacity = lightIndexCapacity;
+		stats.maxClusterLights = maxClusterLights;
+		//the per cluster limit is a fixed size array in the shader, nothing to grow, so it's only reported when it gets worse
+		if (maxClusterLights > MAX_CLUSTER_LIGHTS && maxClusterLights > worstClusterLights)
+		{
+			PT_CORE_WARN("A light cluster sees {0} lights, only the first {1} are shaded", maxClusterLights, MAX_CLUSTER_LIGHTS);
+			worstClusterLights = maxClusterLights;
+		}
+		if (required <= lightIndexCapacity) return;
+		stats.numLightIndicesDropped = required - lightIndexCapacity;
+		//the list is shared by every frame in flight, so the gpu can't be using it
+		RendererBase::Get().mainFence->Wait(RendererBase::Get().currentFenceVal);
+		lightIndexCapacity = std::max(required, lightIndexCapacity * 2);
+		lightIndexList.CreateStack(nullptr, sizeof(uint32_t) * lightIndexCapacity);
+		graph.ReplaceBuffer(lightIndicesHandle, lightIndexList.GetID(), sizeof(uint32_t) * lightIndexCapacity);
+		sceneInfo.UpdateBufferBinding(lightIndexList.GetID(), 0, sizeof(uint32_t) * lightIndexCapacity, RHI::DescriptorType::StructuredBuffer, 6);
+		cullLightsInfo.UpdateBufferBinding(lightIndexList.GetID(), 0, sizeof(uint32_t) * lightIndexCapacity, RHI::DescriptorType::CSBuffer, 4);
+	}
+	void Scene::UpdateLightsBuffer()
+	{
+		PT_PROFILE_FUNCTION();
+		uint32_t requiredSize = LightListLayout::GetSize((uint32_t)regularLights.size(), (uint32_t)shadowLights.size());
+		ReserveLightList(requiredSize);
+		stats.numLights = (uint32_t)(regularLights.size() + shadowLights.size());
+		stats.lightListBytes = requiredSize;
+		stats.lightListCapacity = lightListSize;
+		//both lists go straight to their place in the buffer
+		LightListLayout::Upload(lightList.GetID(), regularLights, shadowLights);
+	}
+	//Pratical Subdivision Scheme, i(index), n(num cascades), lambda(number btw 0 and 1)
+	static float pss(int i, int n, float lambda, float near, float far)
+	{
+    	float uni = ((far-near)/((float)n)) * ((float)i) + near;
+    	float log = near * powf((far/near), ((float)i)/((float)n));
+    
+    	return lambda*uni + (1-lambda)*log;
+	}
+	constexpr const uint32_t shadow_size = 512;
+	void Scene::FrustumCull(const Matrix4& view, const Matrix4& proj, float fovRad, float nearClip, float farClip, float aspect)
+	{
+		BoundingFrustum cameraFrustum(proj);
+		cameraFrustum.Transform(cameraFrustum, view.Invert());
+		SyncMeshBounds();
+		SyncLightBounds();
+		DirectX::XMFLOAT4 planes[6];
+		AABBTree::GetPlanes(cameraFrustum, planes);
+		visibleLights.clear();
+		stats.numCullingNodesVisited += cullingTree.Query(planes, 6, gpuCulling ? LightLayer : MeshLayer | LightLayer, [this](entt::entity e, uint32_t layer)
+			{
+				if (layer == MeshLayer) meshesToDraw.push_back(e);
+				else visibleLights.push_back(e);
+			});
+		//every mesh with bounds is a candidate, the culling pass drops the ones outside the frustum
+		if (gpuCulling)
+			for (uint32_t slot = 0; slot < meshBounds.Size(); slot++)
+				if (meshBounds.IsValid(slot)) meshesToDraw.push_back(meshBounds.GetEntity(slot));
+		stats.numMeshesCulled = meshBounds.Size() - (uint32_t)meshesToDraw.size();
+		if (occlusionCulling && !gpuCulling) OcclusionCull(view * proj);
+		stats.numMeshesVisible = (uint32_t)meshesToDraw.size();
+		std::sort(visibleLights.begin(), visibleLights.end());
+
+		shadowFrame++;
+		//the lights that moved have a new region, the shadow cache is keyed by region so they're simply redrawn
+		if (shadowAtlasFragmented)
+		{
+			stats.numShadowMapsMoved += (uint32_t)sm_allocator.DeFragment().size();
+			shadowAtlasFragmented = false;
+		}
+		auto light_transform = m_Registry.view<LightComponent, TransformComponent>();
+		for (auto& entity : light_transform)
+		{
+			auto [lightcomponent,tc] = light_transform.get(entity);
+			//free space in the shadow map from non visible lights
+			if (lightcomponent.Type == LightType::Point || lightcomponent.Type == LightType::Spot)
+			{
+				bool visible = std::binary_search(visibleLights.begin(), visibleLights.end(), entity);
+				if (!visible)
+				{
+					if (lightcomponent.shadowMap)
+					{
+						sm_allocator.DeAllocate(lightcomponent.shadowMap);
+						lightcomponent.shadowMap = 0;
+					}
+					continue;
+				}
+			}
+			Light light;
+			light.position = tc.Translation;
+			light.type = lightcomponent.Type;
+			float z = 1.f;
+			if (light.type == LightType::Directional) z = -1.f;
+			DirectX::XMVECTOR lightTransform = DirectX::XMVector3Rotate(DirectX::XMVectorSet(0.f, 0.f, z, 1.f), tc.Rotation);
+			DirectX::XMStoreFloat4(&light.rotation, lightTransform);
+			light.exData = { lightcomponent.exData.x , lightcomponent.exData.y, lightcomponent.exData.z, (float)lightcomponent.shadow };
+			light.color = { lightcomponent.color.x, lightcomponent.color.y, lightcomponent.color.z };
+			light.intensity = lightcomponent.Intensity;
+			if (lightcomponent.shadow)
+			{
+				iVector2 allocation_size;
+				ShadowCastingLight* sclight = 0;
+				if (lightcomponent.Type == LightType::Directional)
+				{
+					sclight = &*shadowLights.insert(shadowLights.begin(),ShadowCastingLight());
+					sclight->light = light;
+					numShadowDirLights++;
+					allocation_size = { shadow_size * 4, shadow_size * 4 };
+				}
+				else if (lightcomponent.Type == LightType::Spot)
+				{
+					sclight = &shadowLights.emplace_back();
+					sclight->light = light;
+					DirectX::XMStoreFloat4x4(&sclight->projection[0],DirectX::XMMatrixTranspose(DirectX::XMMatrixLookAtLH(tc.Translation, DirectX::XMVectorAdd(tc.Translation, DirectX::XMLoadFloat4(&light.rotation)), DirectX::XMVectorSet(0, 1, 0, 0)) * DirectX::XMMatrixPerspectiveFovLH(DirectX::XMScalarACos(lightcomponent.exData.x) * 2, 1, 0.1f, lightcomponent.exData.z)));
+				}
+				else if (lightcomponent.Type == LightType::Point)
+				{
+					sclight = &shadowLights.emplace_back();
+					sclight->light = light;
+					//todo : Handle point light matrices;
+				}
+				
+				if (lightcomponent.Type != LightType::Directional)
+				{
+					//spot and point lights get their region once every light's footprint is known, see AllocateShadowMaps
+					DirectX::XMFLOAT3 center;
+					DirectX::XMStoreFloat3(&center, DirectX::XMVector3TransformCoord(tc.Translation, view));
+					uint32_t tilesX = lightcomponent.Type == LightType::Point ? 3 : 1;
+					uint32_t tilesY = lightcomponent.Type == LightType::Point ? 2 : 1;
+					uint32_t currentSize = lightcomponent.shadowMap ? sm_allocator.GetRegion(lightcomponent.shadowMap).size.y / tilesY : 0;
+					float coverage = ShadowBudget::ScreenCoverage(center.x, center.y, center.z, lightcomponent.exData.z, std::tan(fovRad * 0.5f), aspect);
+					shadowRequests.push_back({ coverage, tilesX, tilesY, currentSize });
+					shadowRequestLights.push_back(entity);
+				}
+				else if (lightcomponent.shadowMap != 0) // if there was a shadow map dont allocate a new one unnecessarily
+				{
+					//todo camera cascades for varying shadow map sizes at different distance levels
+					sclight->shadowMap = sm_allocator.GetRegion(lightcomponent.shadowMap);
+				}
+				else
+				{
+					lightcomponent.shadowMap = sm_allocator.Allocate(allocation_size, AllocatorFlags::None); // todo render settings to control allocation size
+					iVector2 portion = sm_allocator.GetPortionSize();
+					if (!lightcomponent.shadowMap && sm_allocator.GetFreeArea() * portion.x * portion.y >= allocation_size.x * allocation_size.y)
+						shadowAtlasFragmented = true;
+					sclight->shadowMap = sm_allocator.GetRegion(lightcomponent.shadowMap);
+				}
+				//cascades need the light's region, a held cascade keeps the matrix its depth was drawn with
+				if (lightcomponent.Type == LightType::Directional)
+				{
+					float pss_vals[3];
+					for(uint32_t i = 0; i < 3; i++) pss_vals[i] = pss(i+1,4,0.3,nearClip,farClip);
+					/*
+						Massive Hack, But for a directional light, the translation doesn't matter, so we store the cascade plane distances there
+					*/
+					sclight->light.position = Vector3(pss_vals);
+					float cascadeNear[4] = { nearClip, pss_vals[0], pss_vals[1], pss_vals[2] };
+					float cascadeFar[4] = { pss_vals[0], pss_vals[1], pss_vals[2], farClip };
+					for (uint32_t i = 0; i < 4; i++)
+					{
+						if (const ShadowViewCache* held = GetHeldCascade(*sclight, i))
+						{
+							sclight->projection[i] = held->projection;
+							continue;
+						}
+						DirectX::XMStoreFloat4x4(&sclight->projection[i], GetStableLightMatrix(view, DirectX::XMMatrixPerspectiveFovLH(fovRad, aspect, cascadeNear[i], cascadeFar[i]),
+							light, i == 0 ? 1.05f : 1.2f, GetShadowViewArea(*sclight, i).size.width));
+					}
+				}
+			}
+			else
+			{
+				if (lightcomponent.shadowMap != 0)
+				{
+					sm_allocator.DeAllocate(lightcomponent.shadowMap);
+					lightcomponent.shadowMap = 0;
+				}
+				regularLights.push_back(light);
+			}
+		}
+		AllocateShadowMaps();
+		CullShadowCasters();
+	}
+	void Scene::AllocateShadowMaps()
+	{
+		PT_PROFILE_FUNCTION();
+		//the directional lights are already in, the rest of the atlas less some room for packing is shared by the others
+		uint64_t directionalArea = (uint64_t)numShadowDirLights * (shadow_size * 4) * (shadow_size * 4);
+		uint64_t freeArea = sm_allocator.GetTotalArea() > directionalArea ? sm_allocator.GetTotalArea() - directionalArea : 0;
+		ShadowBudget::Settings settings;
+		settings.texelBudget = freeArea * 3 / 4;
+		shadowRequestSizes.resize(shadowRequests.size());
+		stats.numShadowTexelsAssigned = (uint32_t)ShadowBudget::Assign(settings, sceneResolution[0] * sceneResolution[1], shadowRequests, shadowRequestSizes);
+		//every region that changes size is freed first, so the lights that grow can use what the shrinking ones give back
+		for (uint32_t i = 0; i < shadowRequests.size(); i++)
+		{
+			auto& lightcomponent = m_Registry.get<LightComponent>(shadowRequestLights[i]);
+			if (!lightcomponent.shadowMap || shadowRequests[i].currentSize == shadowRequestSizes[i]) continue;
+			sm_allocator.DeAllocate(lightcomponent.shadowMap);
+			lightcomponent.shadowMap = 0;
+			stats.numShadowMapsResized++;
+		}
+		iVector2 portion = sm_allocator.GetPortionSize();
+		for (uint32_t i = 0; i < shadowRequests.size(); i++)
+		{
+			auto& lightcomponent = m_Registry.get<LightComponent>(shadowRequestLights[i]);
+			if (!lightcomponent.shadowMap)
+			{
+				iVector2 allocation_size = { shadowRequestSizes[i] * shadowRequests[i].tilesX, shadowRequestSizes[i] * shadowRequests[i].tilesY };
+				lightcomponent.shadowMap = sm_allocator.Allocate(allocation_size, AllocatorFlags::None);
+				if (!lightcomponent.shadowMap && sm_allocator.GetFreeArea() * portion.x * portion.y >= allocation_size.x * allocation_size.y)
+					shadowAtlasFragmented = true;
+			}
+			//the spot and point lights were appended in order after the directional ones
+			shadowLights[numShadowDirLights + i].shadowMap = sm_allocator.GetRegion(lightcomponent.shadowMap);
+		}
+		shadowRequests.clear();
+		shadowRequestLights.clear();
+	}
+	void Scene::OcclusionCull(const Matrix4& viewProj)
+	{
+		PT_PROFILE_FUNCTION();
+		auto start = std::chrono::high_resolution_clock::now();
+		occlusionCuller.Begin(viewProj);
+		auto meshes = m_Registry.view<MeshRendererComponent, TransformComponent>();
+		auto* assetMan = GetAssetManager();
+		//only occluders in the frustum are drawn, the ones outside can't hide anything on screen
+		for (auto entity : meshesToDraw)
+		{
+			auto [meshc, tc] = meshes.get(entity);
+			if (!meshc.occluder) continue;
+			const Model* model = assetMan->GetResource<Model>(meshc.Model);
+			if (!model) continue;
+			const Mesh& mesh = model->meshes[meshc.modelIndex];
+			const auto& vertices = mesh.GetVertices();
+			const auto& indices = mesh.GetIndices();
+			if (vertices.empty()) continue;
+			occlusionCuller.RenderTriangles(&vertices[0].position.x, (uint32_t)vertices.size(), sizeof(Vertex), indices.data(), (uint32_t)indices.size(), tc.worldSpaceTransform);
+		}
+		auto rasterized = std::chrono::high_resolution_clock::now();
+		//occluders are tested like every other mesh, their own triangles never hide their box
+		uint32_t kept = 0;
+		for (auto entity : meshesToDraw)
+		{
+			const auto& meshc = meshes.get<MeshRendererComponent>(entity);
+			if (occlusionCuller.IsOccluded(meshBounds.GetWorld(meshc.boundsSlot))) continue;
+			meshesToDraw[kept++] = entity;
+		}
+		stats.numMeshesOccluded = (uint32_t)meshesToDraw.size() - kept;
+		meshesToDraw.resize(kept);
+		auto end = std::chrono::high_resolution_clock::now();
+		stats.numOccluderTriangles = occlusionCuller.GetStats().numTrianglesRasterized;
+		stats.occlusionRasterMs = std::chrono::duration<float, std::milli>(rasterized - start).count();
+		stats.occlusionTestMs = std::chrono::duration<float, std::milli>(end - rasterized).count();
+	}
+
+
 }
\ No newline at end of file
@@ -1,129 +1,415 @@
-#pragma once
-#include "Pistachio/Core/Math.h"
-#include "entt.hpp"
-#include "Pistachio/Renderer/RenderTexture.h"
-#include "Pistachio/Renderer/EditorCamera.h"
-#include "Pistachio/Core/UUID.h"
-#include "Pistachio/Renderer/Mesh.h"
-#include "Pistachio/Allocators/AtlasAllocator.h"
-#include "Pistachio/Renderer/Renderer.h"
-#include "Pistachio/Event/SceneGraphEvent.h"
-#include "Pistachio/Renderer/RenderGraph.h"
-namespace physx {
-	class PxScene;
-}
-namespace Pistachio {
-	struct PISTACHIO_API alignas(16) PassConstants
-	{
-		DirectX::XMFLOAT4X4 View;
-		DirectX::XMFLOAT4X4 InvView;
-		DirectX::XMFLOAT4X4 Proj;
-		DirectX::XMFLOAT4X4 InvProj;
-		DirectX::XMFLOAT4X4 ViewProj;
-		DirectX::XMFLOAT4X4 InvViewProj;
-		DirectX::XMFLOAT2 RenderTargetSize;
-		DirectX::XMFLOAT2 InvRenderTargetSize;
-		float NearZ;
-		float FarZ;
-		float TotalTime;
-		float DeltaTime;
-		DirectX::XMFLOAT3 EyePosW;
-		float scale;
-		DirectX::XMFLOAT3 numClusters;
-		float bias;
-		uint32_t numRegularLights;
-		uint32_t numShadowLights;
-		uint32_t numDirectionalRegularLights;
-		uint32_t numDirectionalShadowLights;
-	};
-	class Entity;
-	struct PISTACHIO_API SceneDesc
-	{
-		Vector2 Resolution;
-		uint32_t clusterX;
-		uint32_t clusterY;
-		uint32_t clusterZ;
-		SceneDesc() : Resolution(1920,1080), clusterX(16), clusterY(9), clusterZ(24) {}
-	};
-	class PISTACHIO_API Scene {
-	public:
-		explicit Scene(SceneDesc desc  = SceneDesc());
-		~Scene();
-		Entity CreateEntity(const std::string& name = "");
-		Entity DuplicateEntity(Entity e);
-		Entity CreateEntityWithUUID(UUID ID, const std::string& name = "");
-		void OnRuntimeStart();
-		void OnRuntimeStop();
-		void OnUpdateEditor(float delta, EditorCamera& camera);
-		void OnUpdateRuntime(float delta);
-		void OnViewportResize(unsigned int width, unsigned int height);
-		void DestroyEntity(Entity entity);
-		void DefferedDelete(Entity entity);
-		void ReparentEntity(Entity entity, Entity new_parent);
-		void SyncSkybox();
-		template<typename _ComponentTy> auto GetAllComponents() { return m_Registry.view<_ComponentTy>(); }
-		Entity GetRootEntity();
-		Entity GetPrimaryCameraEntity();
-		Entity GetEntityByUUID(UUID id);
-		Entity GetEntityByName(const std::string& name);
-		std::vector<Entity> GetAllEntitesWithName(const std::string& name);
-		void UpdatePassConstants(const Matrix4& view, const SceneCamera& cam, const Vector3& camPos, float delta);
-		void UpdatePassConstants(const EditorCamera& cam, float delta);
-		const RenderTexture& GetFinalRender();
-		//const RenderTexture& GetGBuffer() { return m_gBuffer; };
-		//const RenderTexture& GetRenderedScene() { return m_finalRender; };
-
-	private:
-		Entity CreateRootEntity(UUID ID);
-		void UpdateObjectCBs();
-		void SortMeshComponents();
-		void UpdateLightsBuffer();
-		void FrustumCull(const Matrix4& view, const Matrix4& proj, float fovRad, float nearClip,float farClip,float aspect);
-		DirectX::XMMATRIX GetTransfrom(Entity e);
-		void UpdateTransforms(entt::entity e, const Matrix4& mat);
-	private:
-		friend class FrameComposer;
-		friend class Entity;
-		friend class SceneHierarchyPanel;
-		friend class SceneSerializer;
-		std::vector<entt::entity> meshesToDraw;
-		std::vector<ShadowCastingLight> shadowLights;
-		std::vector<RegularLight> regularLights;
-		std::vector<entt::entity> deletionQueue;
-		uint32_t numShadowDirLights = 0;
-		uint32_t numRegularDirLights = 0;
-		AtlasAllocator sm_allocator;
-		entt::registry m_Registry;
-		entt::entity root;
-		physx::PxScene* m_PhysicsScene = nullptr;
-		RGTextureHandle finalRenderTex{};
-		uint32_t lightListSize = 0;
-		uint32_t clustersDim[3]{};
-		uint32_t sceneResolution[2]{};
-		PassConstants passConstants{};
-		StructuredBuffer shadowMarker;//replace with a push constant
-		//consider fusing these two
-		StructuredBuffer clusterAABB;
-		StructuredBuffer activeClustersBuffer;
-		StructuredBuffer sparseActiveClustersBuffer_lightIndices;
-		StructuredBuffer lightList;
-		StructuredBuffer lightGrid;
-		ResourceSet passCBinfoGFX[RendererBase::numFramesInFlight];
-		ResourceSet passCBinfoCMP[RendererBase::numFramesInFlight];
-		ResourceSet passCBinfoVS_PS[RendererBase::numFramesInFlight];
-		ResourceSet buildClusterInfo;
-		ResourceSet activeClusterInfo;
-		ResourceSet tightenListInfo;
-		ResourceSet cullLightsInfo;
-		ResourceSet sceneInfo;
-		ResourceSet shadowSetInfo;
-		ResourceSet backgroundInfo;
-		DepthTexture shadowMapAtlas;
-		DepthTexture zPrepass;
-		RenderTexture finalRender;
-		StructuredBuffer computeShaderMiscBuffer;
-		ConstantBuffer passCB[RendererBase::numFramesInFlight];
-		RenderGraph graph;
-	};
-
+#pragma once
+#include "Pistachio/Core/Math.h"
+#include "entt.hpp"
+#include "Pistachio/Renderer/RenderTexture.h"
+#include "Pistachio/Renderer/EditorCamera.h"
+#include "Pistachio/Core/UUID.h"
+#include "Pistachio/Renderer/Mesh.h"
+#include "Pistachio/Allocators/GuillotineAllocator.h"
+#include "Pistachio/Renderer/Renderer.h"
+#include "Pistachio/Event/SceneGraphEvent.h"
+#include "Pistachio/Renderer/RenderGraph.h"
+#include "TransformHierarchy.h"
+#include "WorldBounds.h"
+#include "AABBTree.h"
+#include "MaskedOcclusionCuller.h"
+#include "ShadowBudget.h"
+#include "Pistachio/Renderer/DepthPyramid.h"
+#include "Pistachio/Renderer/GPUScene.h"
+#include "Pistachio/Renderer/IndirectDrawBuffer.h"
+#include "Pistachio/Renderer/RenderQueue.h"
+#include <cfloat>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+namespace physx {
+	class PxScene;
+}
+namespace Pistachio {
+	struct PISTACHIO_API alignas(16) PassConstants
+	{
+		DirectX::XMFLOAT4X4 View;
+		DirectX::XMFLOAT4X4 InvView;
+		DirectX::XMFLOAT4X4 Proj;
+		DirectX::XMFLOAT4X4 InvProj;
+		DirectX::XMFLOAT4X4 ViewProj;
+		DirectX::XMFLOAT4X4 InvViewProj;
+		DirectX::XMFLOAT2 RenderTargetSize;
+		DirectX::XMFLOAT2 InvRenderTargetSize;
+		float NearZ;
+		float FarZ;
+		float TotalTime;
+		float DeltaTime;
+		DirectX::XMFLOAT3 EyePosW;
+		float scale;
+		DirectX::XMFLOAT3 numClusters;
+		float bias;
+		uint32_t numRegularLights;
+		uint32_t numShadowLights;
+		uint32_t numDirectionalRegularLights;
+		uint32_t numDirectionalShadowLights;
+	};
+	class Entity;
+	struct MeshRendererComponent;
+	struct PISTACHIO_API SceneStatistics
+	{
+		uint32_t numTransformsUpdated = 0;
+		uint32_t numMeshesVisible = 0;//with gpu culling, every mesh handed to the culling pass
+		uint32_t numMeshesCulled = 0;//outside the frustum, the occluded ones are counted apart
+		uint32_t numCullingNodesVisited = 0;//aabb tree nodes visited by every culling query this frame
+		uint32_t numObjectUploads = 0;//object constant buffers rewritten this frame
+		uint32_t numStaticObjectUploads = 0;//the part of those that belong to static objects, normally 0 after the first frame
+		uint32_t numObjectsSkipped = 0;//meshes whose constant buffer was already up to date
+		uint32_t numGPUSceneCopies = 0;//memcpy calls made by the per frame gpu scene upload
+		uint32_t numGPUSceneBytes = 0;
+		uint32_t numDraws = 0;//prepass and forward draws, identical meshes share one instanced draw
+		uint32_t numInstances = 0;//meshes drawn by those draws
+		uint32_t numDrawCalls = 0;//indirect calls the draws were submitted with, one per pass or material
+		uint32_t numShadowDraws = 0;
+		uint32_t numShadowInstances = 0;
+		uint32_t numShadowDrawCalls = 0;
+		uint32_t numCascadeCasters[4] = {};//meshes drawn into each cascade, summed over the directional lights
+		uint32_t numSpotCasters = 0;//meshes drawn into the spot light shadow maps, summed over the lights
+		uint32_t numShadowViewsRendered = 0;//spot lights and cascades that drew or copied anything this frame
+		uint32_t numShadowViewsReused = 0;//the ones left as they were last frame
+		uint32_t numShadowViewsHeld = 0;//cascades left as they were because they aren't due for an update, counted in numShadowViewsReused too
+		uint32_t numStaticShadowDraws = 0;//instanced draws into the static shadow cache
+		uint32_t numShadowMapsMoved = 0;//shadow maps moved by repacking the atlas, they miss the shadow cache once
+		uint32_t numShadowMapsResized = 0;//spot and point lights that changed resolution tier this frame
+		uint32_t numShadowTexelsAssigned = 0;//texels the resolution tiers of the spot and point lights add up to
+		uint32_t numCascadeInstances = 0;//caster instances of the single pass cascade lists, one per caster and cascade it's drawn into
+		uint32_t numLights = 0;//regular and shadowed lights in the light list this frame
+		uint32_t lightListBytes = 0;//the part of the light list they use
+		uint32_t lightListCapacity = 0;//bytes, the list grows geometrically when a frame needs more
+		uint32_t numLightListGrowths = 0;//1 on the frames the light list was reallocated
+		uint32_t numLightIndices = 0;//light indices the clusters asked for, read back from a past frame
+		uint32_t lightIndexCapacity = 0;//indices the clusters' compact light list holds
+		uint32_t numLightIndicesDropped = 0;//the ones that didn't fit, the list grows to hold them from this frame on
+		uint32_t maxClusterLights = 0;//the most lights one cluster saw, read back with numLightIndices, past 128 the cluster drops the rest
+		uint32_t numShaderBinds = 0;//pipeline switches in the forward pass
+		uint32_t numMaterialBinds = 0;
+		uint32_t numGPUCullRecords = 0;//draw records whose instances the gpu culling pass compacted, 0 when it's off
+		uint32_t numMeshesOccluded = 0;//frustum visible meshes the software occlusion buffer hid
+		uint32_t numOccluderTriangles = 0;//triangles rasterized into the occlusion buffer
+		float occlusionRasterMs = 0.f;
+		float occlusionTestMs = 0.f;
+	};
+	enum class QueryPrecision
+	{
+		Bounds,   //only the world space boxes of the meshes
+		Triangles //boxes first, then the mesh triangles
+	};
+	struct PISTACHIO_API RaycastHit
+	{
+		entt::entity entity = entt::null;
+		float distance = 0.f;
+		Vector3 position;
+	};
+	struct PISTACHIO_API SceneDesc
+	{
+		Vector2 Resolution;
+		uint32_t clusterX;
+		uint32_t clusterY;
+		uint32_t clusterZ;
+		bool multithreaded;//spread per-frame updates over the application's worker pool
+		bool gpuCulling;//cull meshes against the camera in a compute pass instead of on the cpu, lights are still culled on the cpu
+		bool occlusionCulling;//rasterize meshes marked as occluders on the cpu and drop the ones hidden behind them, cpu culling only
+		uint32_t cascadeUpdateInterval[4];//frames between two updates of each directional shadow cascade, 1 redraws it every frame
+		bool singlePassCascades;//draw every directional shadow caster once, instanced to the cascades it touches, instead of once per cascade
+		SceneDesc() : Resolution(1920,1080), clusterX(16), clusterY(9), clusterZ(24), multithreaded(true), gpuCulling(false), occlusionCulling(false), cascadeUpdateInterval{ 1, 2, 4, 4 }, singlePassCascades(false) {}
+	};
+	class PISTACHIO_API Scene {
+	public:
+		explicit Scene(SceneDesc desc  = SceneDesc());
+		~Scene();
+		Entity CreateEntity(const std::string& name = "");
+		Entity DuplicateEntity(Entity e);
+		Entity CreateEntityWithUUID(UUID ID, const std::string& name = "");
+		void OnRuntimeStart();
+		void OnRuntimeStop();
+		void OnUpdateEditor(float delta, EditorCamera& camera);
+		void OnUpdateRuntime(float delta);
+		void OnViewportResize(unsigned int width, unsigned int height);
+		void DestroyEntity(Entity entity);
+		void DefferedDelete(Entity entity);
+		void ReparentEntity(Entity entity, Entity new_parent);
+		void ForEachChild(Entity entity, const std::function<void(Entity)>& fn);
+		void SyncSkybox();
+		template<typename _ComponentTy> auto GetAllComponents() { return m_Registry.view<_ComponentTy>(); }
+		Entity GetRootEntity();
+		/*
+		* Lookups are answered from indices kept up to date by registry signals, renames should go through
+		* RenameEntity (or registry patch/replace) for the entity to be found under its new name
+		*/
+		Entity GetPrimaryCameraEntity();
+		Entity GetEntityByUUID(UUID id);
+		Entity GetEntityByName(const std::string& name);
+		std::vector<Entity> GetAllEntitesWithName(const std::string& name);
+		//allocation free version of GetAllEntitesWithName
+		void ForEachEntityWithName(std::string_view name, const std::function<void(Entity)>& fn);
+		void RenameEntity(Entity entity, const std::string& name);
+		void UpdatePassConstants(const Matrix4& view, const SceneCamera& cam, const Vector3& camPos, float delta);
+		void UpdatePassConstants(const EditorCamera& cam, float delta);
+		const RenderTexture& GetFinalRender();
+		const SceneStatistics& GetStatistics() const { return stats; }
+		/*
+		* Spatial queries over mesh renderers, answered from the bounds as of the last update
+		* Raycasts return the closest hit, @ray's direction must be normalized
+		*/
+		bool Raycast(const Ray& ray, float maxDistance, RaycastHit& hit, QueryPrecision precision = QueryPrecision::Bounds) const;
+		//@hits must be as long as @rays, misses are left with a null entity. Large batches are split over the worker pool
+		void RaycastBatch(std::span<const Ray> rays, float maxDistance, std::span<RaycastHit> hits, QueryPrecision precision = QueryPrecision::Bounds);
+		void OverlapSphere(const BoundingSphere& sphere, std::vector<Entity>& out, QueryPrecision precision = QueryPrecision::Bounds);
+		void OverlapBox(const BoundingBox& box, std::vector<Entity>& out, QueryPrecision precision = QueryPrecision::Bounds);
+		//mesh whose bounds are closest to @point, null if none is within @maxDistance
+		Entity FindNearest(const Vector3& point, float maxDistance = FLT_MAX);
+		//when disabled all per-frame updates run on the calling thread, results are identical either way
+		void SetMultithreaded(bool enable) { multithreaded = enable; }
+		bool IsMultithreaded() const { return multithreaded; }
+		//changes whenever a static mesh is added, removed, moved or given another model, before that frame culls its shadow casters
+		uint32_t GetStaticGeometryVersion() const { return staticGeometryVersion; }
+		//const RenderTexture& GetGBuffer() { return m_gBuffer; };
+		//const RenderTexture& GetRenderedScene() { return m_finalRender; };
+
+	private:
+		Entity CreateRootEntity(UUID ID);
+		void UpdateObjectCBs();
+		//fills the prepass and opaque queues from meshesToDraw and sorts them
+		void BuildRenderQueues(const Matrix4& view, float nearClip, float farClip);
+		//writes the object id of every instance and the indirect arguments of this frame's batches, and binds the object buffers
+		void UploadDrawData();
+		//indirect arguments of the prepass and opaque records, the culled copy when gpu culling is on
+		RHI::Ptr<RHI::Buffer> GetMeshDrawArgs() const { return gpuCulling ? culledArgs.GetID() : drawArgs.GetBuffer(RendererBase::GetCurrentFrameIndex()); }
+		//recreates the culled buffers when this frame needs more than they hold, and rebinds them
+		void ReserveCulledBuffers(uint32_t numRecords, uint32_t numInstances);
+		uint32_t GetMeshSortID(const MeshRendererComponent& meshc);
+		void UpdateLightsBuffer();
+		//reallocates the light list when @size bytes don't fit and rebinds every set reading it
+		void ReserveLightList(uint32_t size);
+		//reads the light indices the clusters wanted, growing their list when it was too small
+		void ReadBackLightIndices();
+		void FrustumCull(const Matrix4& view, const Matrix4& proj, float fovRad, float nearClip,float farClip,float aspect);
+		//removes the meshes hidden behind occluders from meshesToDraw
+		void OcclusionCull(const Matrix4& viewProj);
+		DirectX::XMMATRIX GetTransfrom(Entity e);
+		uint32_t UpdateTransforms();
+		ThreadPool* GetWorkerPool() const;
+		//closest triangle hit of @entity's mesh, or a negative value
+		float RaycastTriangles(entt::entity entity, const Ray& ray, float maxDistance) const;
+		template<typename Test>
+		bool OverlapTriangles(entt::entity entity, Test&& test) const;
+		template<typename Volume>
+		void Overlap(const Volume& volume, std::vector<Entity>& out, QueryPrecision precision);
+		void SyncMeshBounds();
+		void SyncLightBounds();
+		//fills casterLists with the meshes touching every shadow light's projection(s)
+		void CullShadowCasters();
+		//decides which shadow views are drawn, copied from the static atlas or reused as they are
+		void UpdateShadowCache();
+		//atlas rectangle of one of @light's views
+		static RHI::Area2D GetShadowViewArea(const ShadowCastingLight& light, uint32_t cascade);
+		static uint64_t GetShadowViewKey(const RHI::Area2D& area);
+		//sizes the spot and point light shadow maps from their screen coverage and (re)allocates the regions that changed
+		void AllocateShadowMaps();
+		//spreads the cascades' updates so every frame draws about as many of them
+		void ScheduleCascadeUpdates(const uint32_t* intervals);
+		//merges a directional light's per cascade lists into cascadeLists, keeping the casters of the views that draw this frame
+		void BuildCascadeLists();
+		//single pass cascades, draws the static (@dynamic false) or dynamic casters of every cascade of light @index in one call
+		void DrawCascades(RHI::Weak<RHI::GraphicsCommandList> list, RHI::RenderingAttachmentDesc& attachDesc, uint32_t index, uint32_t dynamic);
+		/*
+		* Draws @numRecords indirect records from @firstRecord in a single call, the last of the @numConstants push constants
+		* is set to @firstRecord, the shaders add the draw index to find the record and its instance base
+		*/
+		void SubmitRecords(RHI::Weak<RHI::GraphicsCommandList> list, RHI::Ptr<RHI::Buffer> args, uint32_t firstRecord, uint32_t numRecords,
+			uint32_t* constants, uint32_t numConstants);
+		void OnMeshRendererAdded(entt::registry& reg, entt::entity e);
+		void OnMeshRendererRemoved(entt::registry& reg, entt::entity e);
+		void OnMeshBoundsAdded(entt::registry& reg, entt::entity e);
+		void OnMeshBoundsRemoved(entt::registry& reg, entt::entity e);
+		void OnLightAdded(entt::registry& reg, entt::entity e);
+		void OnLightRemoved(entt::registry& reg, entt::entity e);
+		void OnTransformAdded(entt::registry& reg, entt::entity e);
+		void OnIDAdded(entt::registry& reg, entt::entity e);
+		void OnIDUpdated(entt::registry& reg, entt::entity e);
+		void OnIDRemoved(entt::registry& reg, entt::entity e);
+		void OnTagAdded(entt::registry& reg, entt::entity e);
+		void OnTagUpdated(entt::registry& reg, entt::entity e);
+		void OnTagRemoved(entt::registry& reg, entt::entity e);
+		void OnCameraChanged(entt::registry& reg, entt::entity e);
+		//first entity in @name's bucket that still carries that tag
+		entt::entity FindByName(std::string_view name);
+	private:
+		friend class FrameComposer;
+		friend class Entity;
+		friend class SceneHierarchyPanel;
+		friend class SceneSerializer;
+		std::vector<entt::entity> meshesToDraw;
+		RenderQueue prepassQueue;
+		RenderQueue opaqueQueue;
+		SortKeyIDs shaderIDs;
+		SortKeyIDs materialIDs;
+		SortKeyIDs meshIDs;
+		std::vector<entt::entity> visibleLights;
+		/*
+		* Shadow casters of every shadow view (light * 4 + cascade, spot lights only use their first view),
+		* casterLists[view * 2] holds the static casters and casterLists[view * 2 + 1] the dynamic ones,
+		* both index into the items and batches of shadowQueue
+		*/
+		struct CasterList { uint32_t offset; uint32_t count; uint32_t firstBatch; uint32_t numBatches; };
+		RenderQueue shadowQueue;
+		std::vector<CasterList> casterLists;
+		/*
+		* Single pass cascades, every directional light has a static and a dynamic list (light * 2 + dynamic) holding all its cascades.
+		* A caster has one item per cascade it's drawn into, items of a batch are ordered by cascade and the instance carries it
+		*/
+		RenderQueue cascadeQueue;
+		std::vector<CasterList> cascadeLists;
+		//per light query results of CullShadowCasters, filled by the workers before the lists are merged into shadowQueue
+		struct CasterScratch { std::vector<entt::entity> casters[4]; uint32_t nodesVisited = 0; };
+		std::vector<CasterScratch> casterScratch;
+		/*
+		* Shadow caching, every view keeps the depth of its static casters in staticShadowAtlas, at the same place it has in shadowMapAtlas.
+		* A view whose projection, region and static casters didn't change is left as it is, otherwise its static depth
+		* is copied back into the atlas and only the dynamic casters are drawn over it
+		*/
+		enum ShadowViewAction : uint8_t { ShadowRenderStatic = 1, ShadowCopyStatic = 2, ShadowDrawDynamic = 4, ShadowHeld = 8 };
+		struct ShadowViewCache
+		{
+			DirectX::XMFLOAT4X4 projection;
+			uint64_t staticCasters = 0;//hash of the static caster list
+			uint32_t staticVersion = 0;
+			uint32_t lastFrame = 0;
+			bool hadDynamic = false;
+		};
+		std::unordered_map<uint64_t, ShadowViewCache> shadowViewCache;//keyed by the view's atlas rectangle
+		std::vector<uint8_t> shadowViewActions;//ShadowViewAction flags of every view this frame
+		uint32_t shadowFrame = 0;
+		//a cascade is updated on the frames where (shadowFrame - cascadePhase) is a multiple of its interval, held in between
+		uint32_t cascadeUpdateInterval[4] = { 1, 1, 1, 1 };
+		uint32_t cascadePhase[4] = {};
+		//cache entry of a cascade that isn't due this frame and keeps last update's projection and depth, null when it has to be drawn
+		const ShadowViewCache* GetHeldCascade(const ShadowCastingLight& light, uint32_t cascade) const;
+		//object id of every instance drawn this frame: prepass items, then opaque items, then shadow items, then cascade items
+		std::vector<uint32_t> instanceObjects;
+		uint32_t shadowInstanceBase = 0;
+		//one record per batch: prepass batches, then opaque batches, then shadow batches, then cascade batches
+		IndirectDrawBuffer drawArgs;
+		uint32_t opaqueDrawBase = 0;
+		uint32_t shadowDrawBase = 0;
+		uint32_t cascadeDrawBase = 0;
+		/*
+		* GPU culling, the prepass and opaque records are copied by a compute pass with only the instances inside the frustum,
+		* survivors stay at their candidate's position so the passes read the same offsets from the culled buffers
+		*/
+		bool gpuCulling = false;
+		StructuredBuffer culledArgs;
+		StructuredBuffer culledInstances;
+		uint32_t culledArgsCapacity = 0;//records
+		uint32_t culledInstancesCapacity = 0;
+		RGBufferHandle culledArgsHandle{};
+		RGBufferHandle culledInstancesHandle{};
+		ConstantBuffer gpuCullCB[RendererBase::numFramesInFlight];
+		ResourceSet gpuCullInfo[RendererBase::numFramesInFlight];
+		//object sets reading the culled instances instead of the cpu written ones
+		ResourceSet culledObjectInfoGFX[RendererBase::numFramesInFlight];
+		ResourceSet culledObjectInfoVS_PS[RendererBase::numFramesInFlight];
+		uint32_t boundDrawArgsSize[RendererBase::numFramesInFlight] = {};
+		bool occlusionCulling = false;
+		bool singlePassCascades = false;
+		MaskedOcclusionCuller occlusionCuller;
+		std::vector<ShadowCastingLight> shadowLights;
+		std::vector<RegularLight> regularLights;
+		std::vector<entt::entity> deletionQueue;
+		std::vector<entt::entity> destroyedEntities;
+		SceneStatistics stats;
+		bool multithreaded = true;
+		uint32_t staticGeometryVersion = 0;
+		//scratch for UpdateObjectCBs, kept to avoid reallocating every frame
+		std::vector<entt::entity> objectEntities;
+		std::vector<TransformData> objectData;
+		uint32_t numShadowDirLights = 0;
+		uint32_t numRegularDirLights = 0;
+		GuillotineAllocator sm_allocator;
+		bool shadowAtlasFragmented = false;//a shadow map that would fit in the free area didn't, the atlas is repacked next frame
+		//footprints of this frame's shadowed spot and point lights, in the order they were added to shadowLights
+		std::vector<ShadowBudget::Request> shadowRequests;
+		std::vector<entt::entity> shadowRequestLights;
+		std::vector<uint32_t> shadowRequestSizes;
+		WorldBounds meshBounds;//declared before the registry, it's still used by the destroy callbacks
+		//lookup indices, also declared before the registry
+		struct StringHash
+		{
+			using is_transparent = void;
+			size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+		};
+		std::unordered_map<UUID, entt::entity> uuidIndex;
+		//interned tags, every entity is listed under the tag it had when it was last constructed/patched, in creation order
+		std::unordered_map<std::string, std::vector<entt::entity>, StringHash, std::equal_to<>> tagIndex;
+		std::unordered_map<entt::entity, const std::string*> indexedTags;//points at the key in tagIndex
+		entt::entity primaryCamera = entt::null;
+		bool primaryCameraDirty = true;
+		AABBTree cullingTree;//meshes and point/spot lights
+		GPUScene gpuScene;//object data of every mesh renderer, indexed by MeshRendererComponent::objectID
+		static constexpr uint32_t MeshLayer = 1;
+		static constexpr uint32_t LightLayer = 2;
+		entt::registry m_Registry;
+		TransformHierarchy transformHierarchy;
+		std::vector<entt::entity> dirtyTransforms;//queued by TransformComponent::MarkDirty, may hold destroyed entities
+		entt::entity root;
+		physx::PxScene* m_PhysicsScene = nullptr;
+		RGTextureHandle finalRenderTex{};
+		uint32_t lightListSize = 0;//capacity in bytes
+		RGBufferHandle lightListHandle{};
+		/*
+		* Every active cluster's visible lights packed one after another, light culling hands out the ranges with an atomic counter.
+		* The total it asked for is written to the frame's readback buffer, which grows the list once the frame comes round again,
+		* along with the most lights one cluster saw
+		*/
+		StructuredBuffer lightIndexList;
+		uint32_t lightIndexCapacity = 0;
+		uint32_t worstClusterLights = 0;//the most lights one cluster saw that was logged, past the shader's limit
+		RGBufferHandle lightIndicesHandle{};
+		StructuredBuffer lightIndexReadback[RendererBase::numFramesInFlight];
+		ResourceSet lightIndexReadbackInfo[RendererBase::numFramesInFlight];
+		uint32_t clustersDim[3]{};
+		uint32_t sceneResolution[2]{};
+		PassConstants passConstants{};
+		StructuredBuffer shadowMarker;//replace with a push constant
+		//consider fusing these two
+		StructuredBuffer clusterAABB;
+		StructuredBuffer activeClustersBuffer;
+		StructuredBuffer sparseActiveClustersBuffer;
+		StructuredBuffer lightList;
+		StructuredBuffer lightGrid;
+		ResourceSet passCBinfoGFX[RendererBase::numFramesInFlight];
+		ResourceSet passCBinfoCMP[RendererBase::numFramesInFlight];
+		ResourceSet passCBinfoVS_PS[RendererBase::numFramesInFlight];
+		//gpu scene objects and instance ids, set 0 of every mesh vertex shader
+		ResourceSet objectInfoGFX[RendererBase::numFramesInFlight];
+		ResourceSet objectInfoVS_PS[RendererBase::numFramesInFlight];
+		StructuredBuffer instanceBuffer[RendererBase::numFramesInFlight];
+		uint32_t instanceBufferSize[RendererBase::numFramesInFlight] = {};
+		uint32_t boundObjectBufferSize[RendererBase::numFramesInFlight] = {};
+		uint32_t boundRecordsSize[RendererBase::numFramesInFlight] = {};//size of drawArgs' buffer the object sets read the instance bases from
+		ResourceSet buildClusterInfo;
+		ResourceSet activeClusterInfo;
+		ResourceSet tightenListInfo;
+		ResourceSet cullLightsInfo;
+		ResourceSet sceneInfo;
+		ResourceSet shadowSetInfo;
+		ResourceSet backgroundInfo;
+		DepthTexture shadowMapAtlas;
+		DepthTexture staticShadowAtlas;
+		DepthTexture zPrepass;
+		//(min, max) mips of zPrepass, read by cluster activation and by the next frame's gpu culling
+		DepthPyramid depthPyramid;
+		std::vector<ResourceSet> depthPyramidInfo;//one per mip
+		bool depthPyramidValid = false;//set once a frame built it
+		RenderTexture finalRender;
+		StructuredBuffer computeShaderMiscBuffer;
+		ConstantBuffer passCB[RendererBase::numFramesInFlight];
+		RenderGraph graph;
+	};
+
 }
\ No newline at end of file
@@ -1,12 +1,12 @@
-#pragma once
-#include "Scene.h"
-namespace Pistachio {
-	class PISTACHIO_API SceneSerializer {
-	public:
-		SceneSerializer(const Ref<Scene>& scene);
-		void Serialize(const std::string& filepath);
-		void DeSerialize(const std::string& filepath);
-	private:
-		Ref<Scene> m_Scene;
-	};
-}
+#pragma once
+#include "Scene.h"
+namespace Pistachio {
+	class PISTACHIO_API SceneSerializer {
+	public:
+		SceneSerializer(const Ref<Scene>& scene);
+		void Serialize(const std::string& filepath);
+		void DeSerialize(const std::string& filepath);
+	private:
+		Ref<Scene> m_Scene;
+	};
+}
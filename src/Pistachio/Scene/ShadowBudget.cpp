@@ -0,0 +1,58 @@
+#include "ptpch.h"
+#include "ShadowBudget.h"
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <vector>
+namespace Pistachio
+{
+	float ShadowBudget::ScreenCoverage(float centerX, float centerY, float centerZ, float radius, float tanHalfFovY, float aspect)
+	{
+		float distanceSq = centerX * centerX + centerY * centerY + centerZ * centerZ;
+		if (distanceSq <= radius * radius) return 1.f;
+		if (centerZ <= -radius) return 0.f;
+		//the sphere's silhouette seen from the camera, as a radius on the image plane at distance 1
+		float projected = radius / std::sqrt(distanceSq - radius * radius);
+		float screenRadius = projected / tanHalfFovY;
+		//the screen is 2 high and 2 * aspect wide in those units
+		return std::min(3.14159265f * screenRadius * screenRadius / (4.f * aspect), 1.f);
+	}
+	uint64_t ShadowBudget::Assign(const Settings& settings, uint32_t screenPixels, std::span<const Request> requests, std::span<uint32_t> sizes)
+	{
+		uint32_t minTier = (uint32_t)std::log2((float)settings.minSize);
+		uint32_t maxTier = (uint32_t)std::log2((float)settings.maxSize);
+		uint64_t total = 0;
+		auto area = [&](uint32_t i, uint32_t size) { return (uint64_t)size * size * requests[i].tilesX * requests[i].tilesY; };
+		for (uint32_t i = 0; i < requests.size(); i++)
+		{
+			const Request& r = requests[i];
+			float wanted = r.coverage * screenPixels * settings.texelsPerPixel / (float)(r.tilesX * r.tilesY);
+			float tier = std::clamp(0.5f * std::log2(std::max(wanted, 1.f)), (float)minTier, (float)maxTier);
+			uint32_t rounded = (uint32_t)std::lround(tier);
+			//a light keeps its tier until the footprint is clearly past the rounding point
+			if (r.currentSize)
+			{
+				float current = std::log2((float)r.currentSize);
+				if (std::abs(tier - current) < 0.5f + settings.hysteresis) rounded = std::clamp((uint32_t)std::lround(current), minTier, maxTier);
+			}
+			sizes[i] = 1u << rounded;
+			total += area(i, sizes[i]);
+		}
+		if (total <= settings.texelBudget) return total;
+		//the light giving back the most texels per covered pixel drops first
+		auto value = [&](uint32_t i) { return requests[i].coverage / (float)area(i, sizes[i]); };
+		auto cmp = [&](uint32_t a, uint32_t b) { return value(a) > value(b); };
+		std::priority_queue<uint32_t, std::vector<uint32_t>, decltype(cmp)> candidates(cmp);
+		for (uint32_t i = 0; i < requests.size(); i++)
+			if (sizes[i] > settings.minSize) candidates.push(i);
+		while (total > settings.texelBudget && !candidates.empty())
+		{
+			uint32_t i = candidates.top();
+			candidates.pop();
+			total -= area(i, sizes[i]) - area(i, sizes[i] / 2);
+			sizes[i] /= 2;
+			if (sizes[i] > settings.minSize) candidates.push(i);
+		}
+		return total;
+	}
+}
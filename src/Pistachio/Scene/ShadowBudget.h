@@ -0,0 +1,37 @@
+#pragma once
+#include "Pistachio/Core.h"
+#include <cstdint>
+#include <span>
+namespace Pistachio
+{
+	/*
+	* Picks the shadow map resolution of every shadowed light from how much of the screen it covers.
+	* A light wants about as many shadow texels as the pixels it lights, rounded to a power of two tier between
+	* minSize and maxSize. While the tiers add up to more than the texel budget, the light with the fewest covered pixels
+	* per texel drops a tier. A light only leaves its current tier once its footprint is past the rounding point by
+	* hysteresis of a tier, so a light hovering around a boundary doesn't get a new region every frame.
+	* Everything is plain numbers, the scene feeds it and allocates the regions.
+	*/
+	class PISTACHIO_API ShadowBudget
+	{
+	public:
+		struct Settings
+		{
+			uint32_t minSize = 256;//side of the smallest tier, in texels
+			uint32_t maxSize = 1024;
+			float texelsPerPixel = 1.f;
+			float hysteresis = 0.3f;//in tiers
+			uint64_t texelBudget = UINT64_MAX;
+		};
+		struct Request
+		{
+			float coverage;//fraction of the screen lit, see ScreenCoverage
+			uint32_t tilesX, tilesY;//the region is tilesX x tilesY squares of the tier size, 1x1 for spot lights, 3x2 for point lights
+			uint32_t currentSize;//tier size the light has now, 0 when it has none
+		};
+		//fraction of the screen covered by a sphere at @center (view space, looking down +z) of @radius, 1 when the camera is inside it
+		static float ScreenCoverage(float centerX, float centerY, float centerZ, float radius, float tanHalfFovY, float aspect);
+		//writes every request's tier size to @sizes and returns the texels they add up to, which is over budget only when every light is at minSize
+		static uint64_t Assign(const Settings& settings, uint32_t screenPixels, std::span<const Request> requests, std::span<uint32_t> sizes);
+	};
+}
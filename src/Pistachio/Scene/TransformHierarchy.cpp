@@ -0,0 +1,179 @@
+#include "ptpch.h"
+#include "TransformHierarchy.h"
+
+namespace Pistachio
+{
+	uint32_t TransformHierarchy::CreateNode(entt::entity entity, uint32_t parent)
+	{
+		uint32_t node;
+		if (freeNodes.size())
+		{
+			node = freeNodes.back();
+			freeNodes.pop_back();
+		}
+		else
+		{
+			node = (uint32_t)nodes.size();
+			nodes.emplace_back();
+		}
+		HierarchyNode& n = nodes[node];
+		n.entity = entity;
+		n.parent = n.firstChild = n.lastChild = n.nextSibling = n.prevSibling = InvalidNode;
+		n.sweepIndex = InvalidNode;
+		Link(node, parent);
+		//new nodes are always recomputed on the rebuild
+		orderDirty = true;
+		return node;
+	}
+	void TransformHierarchy::Reparent(uint32_t node, uint32_t newParent)
+	{
+		PT_CORE_ASSERT(node < nodes.size() && newParent < nodes.size() && nodes[node].entity != entt::null && nodes[newParent].entity != entt::null,
+			"Reparenting a node that isn't in the hierarchy");
+		Unlink(node);
+		Link(node, newParent);
+		MarkDirty(node);
+		orderDirty = true;
+	}
+	void TransformHierarchy::DestroySubtree(uint32_t node, std::vector<entt::entity>& removed)
+	{
+		Unlink(node);
+		//walk the subtree using the sibling links, the root's siblings are cut off by the unlink
+		uint32_t current = node;
+		while (current != InvalidNode)
+		{
+			removed.push_back(nodes[current].entity);
+			if (nodes[current].firstChild != InvalidNode)
+			{
+				current = nodes[current].firstChild;
+				continue;
+			}
+			while (current != InvalidNode)
+			{
+				uint32_t next = nodes[current].nextSibling;
+				uint32_t parent = nodes[current].parent;
+				nodes[current].entity = entt::null;
+				freeNodes.push_back(current);
+				if (current == node)
+				{
+					current = InvalidNode;
+					break;
+				}
+				if (next != InvalidNode)
+				{
+					current = next;
+					break;
+				}
+				current = parent;
+			}
+		}
+		orderDirty = true;
+	}
+	void TransformHierarchy::MarkDirty(uint32_t node)
+	{
+		if (node == InvalidNode) return;
+		uint32_t index = nodes[node].sweepIndex;
+		//nodes without a sweep index are new and get recomputed on the rebuild anyway
+		if (index != InvalidNode && !sweepDirty[index])
+		{
+			sweepDirty[index] = 1;
+			dirtyRoots.push_back(node);
+		}
+		anyDirty = true;
+	}
+	void TransformHierarchy::Clear()
+	{
+		nodes.clear();
+		freeNodes.clear();
+		sweepNodes.clear();
+		sweepParents.clear();
+		sweepDirty.clear();
+		sweepWorld.clear();
+		levelStart.clear();
+		sweepSubtreeSize.clear();
+		dirtyRoots.clear();
+		walked.clear();
+		orderDirty = false;
+		anyDirty = false;
+	}
+	void TransformHierarchy::Link(uint32_t node, uint32_t parent)
+	{
+		HierarchyNode& n = nodes[node];
+		n.parent = parent;
+		n.nextSibling = InvalidNode;
+		n.prevSibling = InvalidNode;
+		if (parent == InvalidNode) return;
+		HierarchyNode& p = nodes[parent];
+		if (p.lastChild == InvalidNode)
+		{
+			p.firstChild = p.lastChild = node;
+			return;
+		}
+		nodes[p.lastChild].nextSibling = node;
+		n.prevSibling = p.lastChild;
+		p.lastChild = node;
+	}
+	void TransformHierarchy::Unlink(uint32_t node)
+	{
+		HierarchyNode& n = nodes[node];
+		if (n.prevSibling != InvalidNode) nodes[n.prevSibling].nextSibling = n.nextSibling;
+		if (n.nextSibling != InvalidNode) nodes[n.nextSibling].prevSibling = n.prevSibling;
+		if (n.parent != InvalidNode)
+		{
+			HierarchyNode& p = nodes[n.parent];
+			if (p.firstChild == node) p.firstChild = n.nextSibling;
+			if (p.lastChild == node) p.lastChild = n.prevSibling;
+		}
+		n.parent = n.nextSibling = n.prevSibling = InvalidNode;
+	}
+	void TransformHierarchy::RebuildSweepOrder()
+	{
+		PT_PROFILE_FUNCTION();
+		std::vector<uint32_t> newNodes;
+		std::vector<uint32_t> newParents;
+		std::vector<uint8_t> newDirty;
+		std::vector<DirectX::XMMATRIX> newWorld;
+		const uint32_t count = GetNumNodes();
+		newNodes.reserve(count);
+		newParents.reserve(count);
+		newDirty.reserve(count);
+		newWorld.reserve(count);
+		levelStart.clear();
+		auto push = [&](uint32_t node, uint32_t parentIndex)
+			{
+				uint32_t oldIndex = nodes[node].sweepIndex;
+				nodes[node].sweepIndex = (uint32_t)newNodes.size();
+				newNodes.push_back(node);
+				newParents.push_back(parentIndex);
+				newDirty.push_back(oldIndex == InvalidNode ? 1 : sweepDirty[oldIndex]);
+				newWorld.push_back(oldIndex == InvalidNode ? DirectX::XMMatrixIdentity() : sweepWorld[oldIndex]);
+				anyDirty |= (oldIndex == InvalidNode);
+			};
+		levelStart.push_back(0);
+		for (uint32_t i = 0; i < nodes.size(); i++)
+		{
+			if (nodes[i].entity != entt::null && nodes[i].parent == InvalidNode) push(i, InvalidNode);
+		}
+		//breadth first, every level is appended after the one above it
+		uint32_t levelBegin = 0;
+		while (levelBegin < newNodes.size())
+		{
+			uint32_t levelEnd = (uint32_t)newNodes.size();
+			levelStart.push_back(levelEnd);
+			for (uint32_t i = levelBegin; i < levelEnd; i++)
+			{
+				for (uint32_t child = nodes[newNodes[i]].firstChild; child != InvalidNode; child = nodes[child].nextSibling)
+					push(child, i);
+			}
+			levelBegin = levelEnd;
+		}
+		sweepNodes = std::move(newNodes);
+		sweepParents = std::move(newParents);
+		sweepDirty = std::move(newDirty);
+		sweepWorld = std::move(newWorld);
+		//children come after their parents, so walking backwards finishes every subtree before adding it to its parent
+		sweepSubtreeSize.assign(sweepNodes.size(), 1);
+		for (uint32_t i = (uint32_t)sweepNodes.size(); i-- > 0;)
+			if (sweepParents[i] != InvalidNode) sweepSubtreeSize[sweepParents[i]] += sweepSubtreeSize[i];
+		orderDirty = false;
+	}
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include "Pistachio/Core.h"
+#include "DirectXMath.h"
+#include "entt.hpp"
+#include "Pistachio/Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+namespace Pistachio
+{
+	struct PISTACHIO_API HierarchyNode
+	{
+		entt::entity entity = entt::null;
+		uint32_t parent;
+		uint32_t firstChild;
+		uint32_t lastChild;
+		uint32_t nextSibling;
+		uint32_t prevSibling;
+		uint32_t sweepIndex;//position in the depth ordered arrays, InvalidNode until the next rebuild
+	};
+	/*
+	* Flattened scene hierarchy.
+	* Nodes live in a single array and are linked through parent/first-child/next-sibling indices,
+	* so structural edits only touch the nodes involved. For transform propagation the nodes are
+	* laid out again in depth (breadth-first) order, every parent comes before its children so
+	* world transforms are resolved in one forward sweep.
+	* The depth ordered layout is rebuilt lazily, at most once per Propagate() call, after a structural edit.
+	* Marked nodes are kept in a list, when their subtrees are small only those are walked, otherwise every level is swept.
+	*/
+	class PISTACHIO_API TransformHierarchy
+	{
+	public:
+		static constexpr uint32_t InvalidNode = UINT32_MAX;
+		//levels narrower than this are swept on the calling thread
+		static constexpr uint32_t ParallelGrain = 1024;
+		//walking a subtree chases links and costs a few sweep steps per node, so the dirty subtrees are only walked
+		//when they hold less than this fraction of the nodes, otherwise every level is swept
+		static constexpr uint32_t SubtreeWalkRatio = 8;
+		//Creates a node for @entity as the last child of @parent(InvalidNode for a root node)
+		uint32_t CreateNode(entt::entity entity, uint32_t parent);
+		//Moves @node and its subtree under @newParent, costs O(1) in links. Both have to be live nodes
+		void Reparent(uint32_t node, uint32_t newParent);
+		//Removes @node and all its descendants, appending thier entities to @removed, costs O(subtree)
+		void DestroySubtree(uint32_t node, std::vector<entt::entity>& removed);
+		void MarkDirty(uint32_t node);
+		void Clear();
+		/*
+		* Recomputes world transforms of dirty nodes and thier descendants
+		* @fn is called as DirectX::XMMATRIX fn(entt::entity, DirectX::FXMMATRIX parentWorld) and must return the new world transform
+		* returns the number of nodes that were recomputed
+		* With a @pool, every depth level is split across the workers, @fn must then be safe to call
+		* concurrently for different entities. The result is the same as the single threaded sweep.
+		*/
+		template<typename Fn>
+		uint32_t Propagate(Fn&& fn, ThreadPool* pool = nullptr);
+		template<typename Fn>
+		void ForEachChild(uint32_t node, Fn&& fn) const
+		{
+			for (uint32_t child = nodes[node].firstChild; child != InvalidNode; child = nodes[child].nextSibling)
+				fn(nodes[child].entity);
+		}
+		entt::entity GetEntity(uint32_t node) const { return nodes[node].entity; }
+		uint32_t GetParent(uint32_t node) const { return nodes[node].parent; }
+		uint32_t GetNumNodes() const { return (uint32_t)(nodes.size() - freeNodes.size()); }
+		//number of depth levels in the sweep order, only valid after Propagate()
+		uint32_t GetNumLevels() const { return levelStart.empty() ? 0 : (uint32_t)levelStart.size() - 1; }
+	private:
+		void Link(uint32_t node, uint32_t parent);
+		void Unlink(uint32_t node);
+		void RebuildSweepOrder();
+		template<typename Fn>
+		uint32_t WalkSubtree(uint32_t root, Fn& fn);
+	private:
+		std::vector<HierarchyNode> nodes;
+		std::vector<uint32_t> freeNodes;
+		//depth ordered data, indexed by sweep index
+		std::vector<uint32_t> sweepNodes;
+		std::vector<uint32_t> sweepParents;//sweep index of the parent
+		std::vector<uint8_t> sweepDirty;
+		std::vector<DirectX::XMMATRIX> sweepWorld;
+		std::vector<uint32_t> sweepSubtreeSize;//number of nodes under and including the node
+		std::vector<uint32_t> levelStart;//first sweep index of every depth level, with one extra entry for the end
+		std::vector<uint32_t> dirtyRoots;//nodes marked since the last Propagate, in no particular order
+		std::vector<uint32_t> walked;//sweep indices the subtree walks recomputed, their flags are cleared afterwards
+		bool orderDirty = false;
+		bool anyDirty = false;
+	};
+	//preorder through the sibling links, a node's parent is always recomputed before it
+	template<typename Fn>
+	uint32_t TransformHierarchy::WalkSubtree(uint32_t root, Fn& fn)
+	{
+		uint32_t updated = 0;
+		uint32_t current = root;
+		while (true)
+		{
+			uint32_t index = nodes[current].sweepIndex;
+			uint32_t parent = sweepParents[index];
+			sweepWorld[index] = fn(nodes[current].entity, parent == InvalidNode ? DirectX::XMMatrixIdentity() : sweepWorld[parent]);
+			//2 marks a node recomputed this call, a dirty root inside an already walked subtree is skipped
+			sweepDirty[index] = 2;
+			walked.push_back(index);
+			updated++;
+			if (nodes[current].firstChild != InvalidNode)
+			{
+				current = nodes[current].firstChild;
+				continue;
+			}
+			while (current != root && nodes[current].nextSibling == InvalidNode) current = nodes[current].parent;
+			if (current == root) return updated;
+			current = nodes[current].nextSibling;
+		}
+	}
+	template<typename Fn>
+	uint32_t TransformHierarchy::Propagate(Fn&& fn, ThreadPool* pool)
+	{
+		//a rebuild marks the new nodes dirty without listing them, so it's followed by a full sweep
+		bool rebuilt = orderDirty;
+		if (orderDirty) RebuildSweepOrder();
+		if (!anyDirty) return 0;
+		//nested dirty nodes are counted twice here, which only errs towards the sweep
+		uint64_t walkNodes = 0;
+		for (uint32_t i = 0; !rebuilt && i < dirtyRoots.size(); i++) walkNodes += sweepSubtreeSize[nodes[dirtyRoots[i]].sweepIndex];
+		if (!rebuilt && walkNodes * SubtreeWalkRatio < sweepNodes.size())
+		{
+			//ancestors come first in the sweep order, so every subtree is walked once from its topmost dirty node
+			std::sort(dirtyRoots.begin(), dirtyRoots.end(), [this](uint32_t a, uint32_t b) { return nodes[a].sweepIndex < nodes[b].sweepIndex; });
+			uint32_t updated = 0;
+			for (uint32_t root : dirtyRoots)
+				if (sweepDirty[nodes[root].sweepIndex] != 2) updated += WalkSubtree(root, fn);
+			for (uint32_t index : walked) sweepDirty[index] = 0;
+			walked.clear();
+			dirtyRoots.clear();
+			anyDirty = false;
+			return updated;
+		}
+		//nodes only depend on the level above them, so a level can be processed in any order
+		std::atomic<uint32_t> numUpdated = 0;
+		auto sweep = [&](uint32_t begin, uint32_t end)
+			{
+				uint32_t updated = 0;
+				for (uint32_t i = begin; i < end; i++)
+				{
+					uint32_t parent = sweepParents[i];
+					if (parent != InvalidNode) sweepDirty[i] |= sweepDirty[parent];
+					if (!sweepDirty[i]) continue;
+					sweepWorld[i] = fn(nodes[sweepNodes[i]].entity, parent == InvalidNode ? DirectX::XMMatrixIdentity() : sweepWorld[parent]);
+					updated++;
+				}
+				numUpdated.fetch_add(updated, std::memory_order_relaxed);
+			};
+		if (!pool) sweep(0, (uint32_t)sweepNodes.size());
+		else
+		{
+			for (uint32_t level = 0; level + 1 < levelStart.size(); level++)
+			{
+				uint32_t begin = levelStart[level];
+				ParallelFor(pool, levelStart[level + 1] - begin, ParallelGrain, [&](uint32_t first, uint32_t last)
+					{
+						sweep(begin + first, begin + last);
+					});
+			}
+		}
+		std::fill(sweepDirty.begin(), sweepDirty.end(), 0);
+		dirtyRoots.clear();
+		anyDirty = false;
+		return numUpdated.load();
+	}
+}
@@ -0,0 +1,158 @@
+#include "ptpch.h"
+#include "WorldBounds.h"
+#include <bit>
+#include <cfloat>
+
+namespace Pistachio
+{
+	uint32_t WorldBounds::Add(entt::entity entity)
+	{
+		uint32_t slot = (uint32_t)entities.size();
+		entities.push_back(entity);
+		localCenter.emplace_back(0.f, 0.f, 0.f);
+		localExtents.emplace_back(0.f, 0.f, 0.f);
+		//an index of -1 never matches a real mesh, so new slots are always stale
+		sourceModel.push_back(0);
+		sourceIndex.push_back(-1);
+		moved.push_back(0);
+		Resize(slot + 1);
+		SetLocal(slot, nullptr, 0, -1);
+		return slot;
+	}
+	entt::entity WorldBounds::Remove(uint32_t slot)
+	{
+		uint32_t last = (uint32_t)entities.size() - 1;
+		entt::entity movedEntity = entt::null;
+		if (slot != last)
+		{
+			movedEntity = entities[last];
+			entities[slot] = entities[last];
+			centerX[slot] = centerX[last]; centerY[slot] = centerY[last]; centerZ[slot] = centerZ[last];
+			extentX[slot] = extentX[last]; extentY[slot] = extentY[last]; extentZ[slot] = extentZ[last];
+			localCenter[slot] = localCenter[last];
+			localExtents[slot] = localExtents[last];
+			sourceModel[slot] = sourceModel[last];
+			sourceIndex[slot] = sourceIndex[last];
+			moved[slot] = moved[last];
+		}
+		entities.pop_back();
+		localCenter.pop_back();
+		localExtents.pop_back();
+		sourceModel.pop_back();
+		sourceIndex.pop_back();
+		moved.pop_back();
+		Resize(last);
+		return movedEntity;
+	}
+	void WorldBounds::Clear()
+	{
+		entities.clear();
+		localCenter.clear();
+		localExtents.clear();
+		sourceModel.clear();
+		sourceIndex.clear();
+		moved.clear();
+		Resize(0);
+	}
+	void WorldBounds::Resize(uint32_t count)
+	{
+		//padding boxes have negative extents so they can never pass the plane tests
+		uint32_t padded = (count + Width - 1) / Width * Width;
+		for (auto* v : { &centerX, &centerY, &centerZ }) v->resize(padded, 0.f);
+		for (auto* v : { &extentX, &extentY, &extentZ }) v->resize(padded, -FLT_MAX);
+		for (uint32_t i = count; i < padded; i++) extentX[i] = extentY[i] = extentZ[i] = -FLT_MAX;
+	}
+	void WorldBounds::SetLocal(uint32_t slot, const BoundingBox* box, uint64_t model, int modelIndex)
+	{
+		sourceModel[slot] = model;
+		sourceIndex[slot] = modelIndex;
+		moved[slot] = 1;
+		if (box)
+		{
+			localCenter[slot] = box->Center;
+			localExtents[slot] = box->Extents;
+			return;
+		}
+		localCenter[slot] = { 0.f, 0.f, 0.f };
+		localExtents[slot] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		extentX[slot] = extentY[slot] = extentZ[slot] = -FLT_MAX;
+	}
+	void WorldBounds::SetWorld(uint32_t slot, DirectX::FXMMATRIX world)
+	{
+		using namespace DirectX;
+		const XMFLOAT3& e = localExtents[slot];
+		if (e.x < 0.f) return;
+		//transformed center plus the extents projected on the absolute rotation/scale part of the matrix
+		XMVECTOR center = XMVector3Transform(XMLoadFloat3(&localCenter[slot]), world);
+		XMVECTOR extents = XMVectorMultiply(XMVectorReplicate(e.x), XMVectorAbs(world.r[0]));
+		extents = XMVectorMultiplyAdd(XMVectorReplicate(e.y), XMVectorAbs(world.r[1]), extents);
+		extents = XMVectorMultiplyAdd(XMVectorReplicate(e.z), XMVectorAbs(world.r[2]), extents);
+		XMFLOAT3 c, ex;
+		XMStoreFloat3(&c, center);
+		XMStoreFloat3(&ex, extents);
+		centerX[slot] = c.x; centerY[slot] = c.y; centerZ[slot] = c.z;
+		extentX[slot] = ex.x; extentY[slot] = ex.y; extentZ[slot] = ex.z;
+		moved[slot] = 1;
+	}
+	BoundingBox WorldBounds::GetWorld(uint32_t slot) const
+	{
+		return BoundingBox({ centerX[slot], centerY[slot], centerZ[slot] }, { extentX[slot], extentY[slot], extentZ[slot] });
+	}
+	uint32_t WorldBounds::CullFrustum(const BoundingFrustum& frustum, std::vector<entt::entity>& visible) const
+	{
+		PT_PROFILE_FUNCTION();
+		using namespace DirectX;
+		//frustum planes point outwards, a box is outside when its center is further than its projected radius
+		XMVECTOR planes[6];
+		frustum.GetPlanes(&planes[0], &planes[1], &planes[2], &planes[3], &planes[4], &planes[5]);
+		XMFLOAT4 p[6];
+		for (uint32_t i = 0; i < 6; i++) XMStoreFloat4(&p[i], planes[i]);
+		const size_t first = visible.size();
+#if defined(_XM_SSE_INTRINSICS_)
+		const uint32_t padded = (uint32_t)centerX.size();
+		__m128 nx[6], ny[6], nz[6], d[6], ax[6], ay[6], az[6];
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			nx[i] = _mm_set1_ps(p[i].x); ny[i] = _mm_set1_ps(p[i].y); nz[i] = _mm_set1_ps(p[i].z); d[i] = _mm_set1_ps(p[i].w);
+			ax[i] = _mm_set1_ps(fabsf(p[i].x)); ay[i] = _mm_set1_ps(fabsf(p[i].y)); az[i] = _mm_set1_ps(fabsf(p[i].z));
+		}
+		for (uint32_t base = 0; base < padded; base += Width)
+		{
+			uint32_t mask = 0;
+			for (uint32_t half = 0; half < Width; half += 4)
+			{
+				const uint32_t i = base + half;
+				__m128 cx = _mm_loadu_ps(&centerX[i]), cy = _mm_loadu_ps(&centerY[i]), cz = _mm_loadu_ps(&centerZ[i]);
+				__m128 ex = _mm_loadu_ps(&extentX[i]), ey = _mm_loadu_ps(&extentY[i]), ez = _mm_loadu_ps(&extentZ[i]);
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (uint32_t j = 0; j < 6; j++)
+				{
+					__m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx[j], cx), _mm_mul_ps(ny[j], cy)), _mm_add_ps(_mm_mul_ps(nz[j], cz), d[j]));
+					__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax[j], ex), _mm_mul_ps(ay[j], ey)), _mm_mul_ps(az[j], ez));
+					inside = _mm_and_ps(inside, _mm_cmple_ps(dist, radius));
+				}
+				mask |= (uint32_t)_mm_movemask_ps(inside) << half;
+			}
+			while (mask)
+			{
+				uint32_t bit = (uint32_t)std::countr_zero(mask);
+				mask &= mask - 1;
+				visible.push_back(entities[base + bit]);
+			}
+		}
+#else
+		for (uint32_t i = 0; i < Size(); i++)
+		{
+			bool inside = true;
+			for (uint32_t j = 0; j < 6 && inside; j++)
+			{
+				float dist = p[j].x * centerX[i] + p[j].y * centerY[i] + p[j].z * centerZ[i] + p[j].w;
+				float radius = fabsf(p[j].x) * extentX[i] + fabsf(p[j].y) * extentY[i] + fabsf(p[j].z) * extentZ[i];
+				inside = dist <= radius;
+			}
+			if (inside) visible.push_back(entities[i]);
+		}
+#endif
+		return (uint32_t)(visible.size() - first);
+	}
+}
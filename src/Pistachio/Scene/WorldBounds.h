@@ -0,0 +1,69 @@
+#pragma once
+#include "Pistachio/Core/Math.h"
+#include "entt.hpp"
+#include <cstdint>
+#include <vector>
+namespace Pistachio
+{
+	/*
+	* World space bounding boxes of every mesh in a scene, stored as a structure of arrays.
+	* Every box is kept as a center and extents split over 6 float arrays, padded to a multiple of
+	* 8 so the culling kernel can test 8 boxes per iteration with no tail handling.
+	* The local (model space) box is cached per slot, the world box is only recomputed when
+	* the owning transform changes or the source model is swapped.
+	*/
+	class PISTACHIO_API WorldBounds
+	{
+	public:
+		static constexpr uint32_t InvalidSlot = UINT32_MAX;
+		static constexpr uint32_t Width = 8;
+		uint32_t Add(entt::entity entity);
+		//swap-removes @slot, returns the entity that was moved into it (or entt::null)
+		entt::entity Remove(uint32_t slot);
+		void Clear();
+		//returns true if @slot was built from a different model/mesh index than the ones given
+		bool IsStale(uint32_t slot, uint64_t model, int modelIndex) const
+		{
+			return sourceModel[slot] != model || sourceIndex[slot] != modelIndex;
+		}
+		//sets the model space box, pass nullptr to make the slot invisible until a box is available
+		void SetLocal(uint32_t slot, const BoundingBox* box, uint64_t model, int modelIndex);
+		//recomputes the world box from the cached local one, safe to call concurrently for different slots
+		void SetWorld(uint32_t slot, DirectX::FXMMATRIX world);
+		/*
+		* Appends the entities whose boxes touch @frustum to @visible
+		* the test is conservative: a box is only rejected when it lies fully outside one of the 6 planes
+		* returns the number of entities appended
+		*/
+		uint32_t CullFrustum(const BoundingFrustum& frustum, std::vector<entt::entity>& visible) const;
+		BoundingBox GetWorld(uint32_t slot) const;
+		//false while the slot has no model box
+		bool IsValid(uint32_t slot) const { return localExtents[slot].x >= 0.f; }
+		//calls fn(slot) for every slot whose world box changed since the last call
+		template<typename Fn>
+		void ConsumeMoved(Fn&& fn)
+		{
+			for (uint32_t slot = 0; slot < moved.size(); slot++)
+			{
+				if (!moved[slot]) continue;
+				moved[slot] = 0;
+				fn(slot);
+			}
+		}
+		entt::entity GetEntity(uint32_t slot) const { return entities[slot]; }
+		uint32_t Size() const { return (uint32_t)entities.size(); }
+	private:
+		void Resize(uint32_t count);
+	private:
+		std::vector<entt::entity> entities;
+		//hot data, read by the kernel
+		std::vector<float> centerX, centerY, centerZ;
+		std::vector<float> extentX, extentY, extentZ;
+		//cold data, only read when a transform or model changes
+		std::vector<DirectX::XMFLOAT3> localCenter;
+		std::vector<DirectX::XMFLOAT3> localExtents;
+		std::vector<uint64_t> sourceModel;//uuid of the model asset
+		std::vector<int> sourceIndex;
+		std::vector<uint8_t> moved;
+	};
+}
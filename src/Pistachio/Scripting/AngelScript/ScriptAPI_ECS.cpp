@@ -99,14 +99,8 @@ namespace Pistachio
             }
             CScriptArray* GetAllEntitiesWithName(Scene* scene, const std::string& name)
             {
-                auto entities = scene->GetAllEntitesWithName(name);
-                auto arr = CScriptArray::Create(engine->GetTypeInfoByDecl("array<Pistachio::ECS::Entity>"), entities.size());
-                arr->Reserve(entities.size());
-                uint32_t size = arr->GetSize();
-                for(uint32_t i = 0; i < size; i++)
-                {
-                    arr->InsertLast(&entities[i]);
-                }
+                auto arr = CScriptArray::Create(engine->GetTypeInfoByDecl("array<Pistachio::ECS::Entity>"));
+                scene->ForEachEntityWithName(name, [arr](Entity e) { arr->InsertLast(&e); });
                 return arr;
             }
             void Initialize()
@@ -0,0 +1,38 @@
+#pragma once
+#include "ThreadPool.h"
+#include <cstdint>
+#include <future>
+#include <vector>
+namespace Pistachio
+{
+	/*
+	* Splits [0, count) into chunks of at least @grain items and runs fn(begin, end) for every chunk.
+	* The calling thread takes the first chunk itself and waits for the rest, so the call is blocking.
+	* Runs inline when @pool is null or the range is too small to be worth splitting.
+	* Chunks never overlap, so writes indexed by the loop variable need no synchronization.
+	*/
+	template<typename Fn>
+	void ParallelFor(ThreadPool* pool, uint32_t count, uint32_t grain, Fn&& fn)
+	{
+		if (count == 0) return;
+		if (grain == 0) grain = 1;
+		uint32_t numChunks = pool ? (uint32_t)pool->size() + 1 : 1;
+		uint32_t maxChunks = (count + grain - 1) / grain;
+		if (numChunks > maxChunks) numChunks = maxChunks;
+		if (numChunks <= 1)
+		{
+			fn(0u, count);
+			return;
+		}
+		uint32_t chunkSize = (count + numChunks - 1) / numChunks;
+		std::vector<std::future<void>> pending;
+		pending.reserve(numChunks - 1);
+		for (uint32_t begin = chunkSize; begin < count; begin += chunkSize)
+		{
+			uint32_t end = begin + chunkSize < count ? begin + chunkSize : count;
+			pending.push_back(pool->enqueue([&fn, begin, end]() { fn(begin, end); }));
+		}
+		fn(0u, chunkSize < count ? chunkSize : count);
+		for (auto& f : pending) f.get();
+	}
+}
@@ -0,0 +1,168 @@
+/*
+* Randomized churn of shadow map sized allocations on the guillotine packer, checking after every step that regions
+* stay inside the atlas, never overlap and that free plus used area covers the atlas, and that DeFragment reports
+* exactly the regions it moved. The same churn then times the guillotine packer against AtlasAllocator.
+*/
+#include "Pistachio/Allocators/AtlasAllocator.h"
+#include "Pistachio/Allocators/GuillotineAllocator.h"
+#include "test_utils.h"
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace Pistachio;
+static constexpr uint32_t atlasSize = 4096;
+static constexpr uint32_t portionSize = 256;
+static constexpr uint32_t numSteps = 20000;
+
+//the requests the scene makes: spot lights, point lights and directional lights, mostly small ones
+static iVector2 RandomSize(std::mt19937& rng)
+{
+	static const iVector2 sizes[] = { { 256, 256 }, { 512, 512 }, { 512, 512 }, { 512, 512 }, { 768, 512 }, { 1024, 1024 }, { 2048, 2048 } };
+	return sizes[std::uniform_int_distribution<uint32_t>(0, (uint32_t)std::size(sizes) - 1)(rng)];
+}
+struct Op
+{
+	bool allocate;
+	iVector2 size;
+	uint32_t pick;//which live allocation a free releases
+};
+//a light churn that keeps the atlas around three quarters full
+static std::vector<Op> MakeOps()
+{
+	std::mt19937 rng(5);
+	std::vector<Op> ops(numSteps);
+	for (auto& op : ops)
+	{
+		op.allocate = std::uniform_int_distribution<uint32_t>(0, 99)(rng) < 55;
+		op.size = RandomSize(rng);
+		op.pick = rng();
+	}
+	return ops;
+}
+static bool Overlap(const Region& a, const Region& b)
+{
+	return a.offset.x < b.offset.x + b.size.x && b.offset.x < a.offset.x + a.size.x &&
+		a.offset.y < b.offset.y + b.size.y && b.offset.y < a.offset.y + a.size.y;
+}
+static bool Check(const GuillotineAllocator& allocator, const std::vector<uint32_t>& live, const char*& error)
+{
+	uint32_t used = 0;
+	for (uint32_t i = 0; i < live.size(); i++)
+	{
+		Region a = allocator.GetRegion(live[i]);
+		if (a.offset.x + a.size.x > atlasSize || a.offset.y + a.size.y > atlasSize) { error = "region outside the atlas"; return false; }
+		for (uint32_t j = i + 1; j < live.size(); j++)
+			if (Overlap(a, allocator.GetRegion(live[j]))) { error = "overlapping regions"; return false; }
+		used += (a.size.x / portionSize) * (a.size.y / portionSize);
+	}
+	uint32_t total = (atlasSize / portionSize) * (atlasSize / portionSize);
+	if (used + allocator.GetFreeArea() != total) { error = "free and used area don't cover the atlas"; return false; }
+	return true;
+}
+static uint32_t Stress(const std::vector<Op>& ops)
+{
+	GuillotineAllocator allocator({ atlasSize, atlasSize }, { portionSize, portionSize });
+	std::vector<uint32_t> live;
+	uint32_t failures = 0, allocations = 0, failedAllocations = 0, rescued = 0, defragments = 0, moved = 0, maxFreeRects = 0;
+	const char* error = nullptr;
+	for (uint32_t step = 0; step < ops.size() && !error; step++)
+	{
+		const Op& op = ops[step];
+		if (op.allocate || live.empty())
+		{
+			allocations++;
+			uint32_t id = allocator.Allocate(op.size, AllocatorFlags::None);
+			//a failed request defragments and retries, like the scene does
+			if (!id && allocator.GetFreeArea() * portionSize * portionSize >= op.size.x * op.size.y)
+			{
+				std::unordered_map<uint32_t, Region> before;
+				for (uint32_t l : live) before[l] = allocator.GetRegion(l);
+				std::vector<RegionMove> moves = allocator.DeFragment();
+				defragments++;
+				moved += (uint32_t)moves.size();
+				uint32_t reported = 0;
+				for (uint32_t l : live)
+				{
+					Region now = allocator.GetRegion(l);
+					bool changed = now.offset.x != before[l].offset.x || now.offset.y != before[l].offset.y;
+					for (const auto& m : moves)
+						if (m.id == l && m.from.offset.x == before[l].offset.x && m.from.offset.y == before[l].offset.y &&
+							m.to.offset.x == now.offset.x && m.to.offset.y == now.offset.y) reported++;
+					if (changed) reported += 0x10000;
+				}
+				//every changed region is reported once and nothing else is
+				if (reported != (uint32_t)moves.size() * 0x10001) error = "defragment reported the wrong moves";
+				id = allocator.Allocate(op.size, AllocatorFlags::None);
+				if (id) rescued++;
+			}
+			if (id) live.push_back(id);
+			else failedAllocations++;
+		}
+		else
+		{
+			uint32_t index = op.pick % live.size();
+			allocator.DeAllocate(live[index]);
+			live[index] = live.back();
+			live.pop_back();
+		}
+		maxFreeRects = std::max(maxFreeRects, allocator.GetNumFreeRects());
+		if (!error) Check(allocator, live, error);
+	}
+	printf("guillotine stress, %u steps\n", (uint32_t)ops.size());
+	printf("  %u allocations, %u failed, %u defragments moving %u regions, %u requests rescued by them, at most %u free rectangles\n",
+		allocations, failedAllocations, defragments, moved, rescued, maxFreeRects);
+	if (error) printf("  %s\n", error);
+	failures += Expect("regions stay valid through the churn", !error);
+	//known layout, two halves freed around a used middle merge back into the whole atlas
+	GuillotineAllocator small({ 1024, 1024 }, { 256, 256 });
+	uint32_t a = small.Allocate({ 512, 1024 }, AllocatorFlags::None);
+	uint32_t b = small.Allocate({ 512, 1024 }, AllocatorFlags::None);
+	uint32_t c = small.Allocate({ 256, 256 }, AllocatorFlags::None);
+	failures += Expect("a full atlas refuses", a && b && !c);
+	small.DeAllocate(a);
+	small.DeAllocate(b);
+	failures += Expect("frees merge back into the whole atlas", small.GetNumFreeRects() == 1 && small.GetLargestFreeArea() == 16);
+	uint32_t d = small.Allocate({ 2048, 2048 }, AllocatorFlags::DownscaleOnFail);
+	failures += Expect("downscale on fail", d && small.GetRegion(d).size.x == 1024);
+	return failures;
+}
+//runs the churn once on @allocator and prints how long it took
+template<typename Allocator>
+static void TimeChurn(const char* name, Allocator& allocator, const std::vector<Op>& ops)
+{
+	std::vector<uint32_t> live;
+	uint32_t failed = 0;
+	double ms = Time(1, [&]()
+	{
+		for (const Op& op : ops)
+		{
+			if (op.allocate || live.empty())
+			{
+				uint32_t id = allocator.Allocate(op.size, AllocatorFlags::None);
+				if (id) live.push_back(id);
+				else failed++;
+			}
+			else
+			{
+				uint32_t index = op.pick % live.size();
+				allocator.DeAllocate(live[index]);
+				live[index] = live.back();
+				live.pop_back();
+			}
+		}
+	});
+	printf("  %-16s %8.3f ms, %6.3f us per operation, %u requests failed\n", name, ms, ms * 1000.0 / ops.size(), failed);
+}
+int main()
+{
+	std::vector<Op> ops = MakeOps();
+	uint32_t failures = Stress(ops);
+	printf("same churn, no defragmenting, %ux%u atlas of %u portions\n", atlasSize, atlasSize, portionSize);
+	AtlasAllocator atlas({ atlasSize, atlasSize }, { portionSize, portionSize });
+	GuillotineAllocator guillotine({ atlasSize, atlasSize }, { portionSize, portionSize });
+	TimeChurn("AtlasAllocator", atlas, ops);
+	TimeChurn("guillotine", guillotine, ops);
+	return failures ? 1 : 0;
+}
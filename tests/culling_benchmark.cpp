@@ -0,0 +1,136 @@
+/*
+* Compares the per-object frustum test (BoundingBox::Transform followed by
+* BoundingFrustum::Intersects/Contains) against the SoA WorldBounds kernel and
+* the AABBTree traversal on 100k boxes, then times batched raycasts against the tree
+*/
+#include "Pistachio/Scene/WorldBounds.h"
+#include "Pistachio/Scene/AABBTree.h"
+#include "Pistachio/Threading/ParallelFor.h"
+#include "test_utils.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace Pistachio;
+static constexpr uint32_t numBoxes = 100000;
+static constexpr uint32_t numIterations = 20;
+
+//@spread is the half size of the world the boxes are scattered over, the camera always looks at the center
+static uint32_t Run(const char* name, float spread)
+{
+	using namespace DirectX;
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<float> position(-spread, spread);
+	std::uniform_real_distribution<float> unit(0.f, 1.f);
+	std::vector<BoundingBox> locals(numBoxes);
+	std::vector<XMMATRIX> worlds(numBoxes);
+	WorldBounds bounds;
+	for (uint32_t i = 0; i < numBoxes; i++)
+	{
+		locals[i] = BoundingBox({ unit(rng), unit(rng), unit(rng) }, { 0.5f + unit(rng), 0.5f + unit(rng), 0.5f + unit(rng) });
+		worlds[i] = XMMatrixScaling(1.f + unit(rng), 1.f, 1.f) * XMMatrixRotationRollPitchYaw(unit(rng) * 6.f, unit(rng) * 6.f, 0.f) *
+			XMMatrixTranslation(position(rng), position(rng) * 0.1f, position(rng));
+		uint32_t slot = bounds.Add((entt::entity)i);
+		bounds.SetLocal(slot, &locals[i], 1, 0);
+	}
+	BoundingFrustum frustum(XMMatrixPerspectiveFovLH(XMConvertToRadians(60.f), 16.f / 9.f, 0.1f, 300.f));
+	frustum.Transform(frustum, XMMatrixInverse(nullptr, XMMatrixLookAtLH(XMVectorSet(0, 20, -50, 1), XMVectorSet(0, 0, 0, 1), XMVectorSet(0, 1, 0, 0))));
+
+	std::vector<entt::entity> reference;
+	double current = Time(numIterations, [&]()
+		{
+			reference.clear();
+			for (uint32_t i = 0; i < numBoxes; i++)
+			{
+				BoundingBox box = locals[i];
+				box.Transform(box, worlds[i]);
+				if (frustum.Intersects(box) || frustum.Contains(box)) reference.push_back((entt::entity)i);
+			}
+		});
+	//every box moved this frame
+	double update = Time(numIterations, [&]() { for (uint32_t i = 0; i < numBoxes; i++) bounds.SetWorld(i, worlds[i]); });
+	std::vector<entt::entity> visible;
+	double kernel = Time(numIterations, [&]() { visible.clear(); bounds.CullFrustum(frustum, visible); });
+
+	AABBTree tree;
+	std::vector<uint32_t> leaves(numBoxes);
+	auto start = std::chrono::high_resolution_clock::now();
+	for (uint32_t i = 0; i < numBoxes; i++) leaves[i] = tree.Insert(bounds.GetWorld(i), (entt::entity)i, 1);
+	double build = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	XMFLOAT4 planes[6];
+	AABBTree::GetPlanes(frustum, planes);
+	std::vector<entt::entity> treeVisible;
+	uint32_t visited = 0;
+	double query = Time(numIterations, [&]() { treeVisible.clear(); visited = tree.Query(planes, 6, 1, [&](entt::entity e, uint32_t) { treeVisible.push_back(e); }); });
+	//1% of the boxes drift a little, a tenth of those teleport
+	std::uniform_int_distribution<uint32_t> pick(0, numBoxes - 1);
+	uint32_t reinserted = 0;
+	double refit = Time(numIterations, [&]()
+		{
+			for (uint32_t i = 0; i < numBoxes / 100; i++)
+			{
+				uint32_t n = pick(rng);
+				BoundingBox box = bounds.GetWorld(n);
+				if (i % 10 == 0) box.Center = { position(rng), position(rng) * 0.1f, position(rng) };
+				else box.Center.x += 0.01f;
+				reinserted += tree.Move(leaves[n], box);
+			}
+		});
+
+	//both culling paths are conservative, they must keep everything the exact test keeps
+	auto countMissing = [&](const std::vector<entt::entity>& kept)
+		{
+			std::unordered_set<entt::entity> set(kept.begin(), kept.end());
+			uint32_t missing = 0;
+			for (auto e : reference) if (!set.count(e)) missing++;
+			return missing;
+		};
+	uint32_t missing = countMissing(visible);
+	uint32_t treeMissing = countMissing(treeVisible);
+	printf("%s, %u boxes\n", name, numBoxes);
+	printf("  current path (transform + intersects/contains): %8.3f ms, %zu visible\n", current, reference.size());
+	printf("  soa kernel, static frame:                       %8.3f ms, %zu visible, %zu culled\n", kernel, visible.size(), numBoxes - visible.size());
+	printf("  soa kernel, every box moved:                    %8.3f ms\n", update + kernel);
+	printf("  aabb tree build:                                %8.3f ms (height %u)\n", build, tree.GetHeight());
+	printf("  aabb tree query:                                %8.3f ms, %zu visible, %u nodes visited\n", query, treeVisible.size(), visited);
+	printf("  aabb tree refit, 1%% moved:                      %8.3f ms (%u reinserts)\n", refit, reinserted);
+	printf("  boxes kept by the current path but culled: kernel %u, tree %u\n", missing, treeMissing);
+
+	//line of sight style batch, short rays between random points
+	constexpr uint32_t numRays = 10000;
+	std::vector<XMVECTOR> origins(numRays), directions(numRays);
+	for (uint32_t i = 0; i < numRays; i++)
+	{
+		origins[i] = XMVectorSet(position(rng), position(rng) * 0.1f, position(rng), 1.f);
+		directions[i] = XMVector3Normalize(XMVectorSet(unit(rng) - 0.5f, unit(rng) - 0.5f, unit(rng) - 0.5f, 0.f));
+	}
+	std::vector<entt::entity> rayHits(numRays);
+	auto castRays = [&](ThreadPool* pool)
+		{
+			ParallelFor(pool, numRays, 64, [&](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t i = begin; i < end; i++)
+					{
+						float closest = 100.f;
+						rayHits[i] = entt::null;
+						tree.Raycast(origins[i], directions[i], closest, 1, [&](entt::entity e, float distance) { rayHits[i] = e; return closest = distance; });
+					}
+				});
+		};
+	double raysSingle = Time(numIterations, [&]() { castRays(nullptr); });
+	ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+	double raysPooled = Time(numIterations, [&]() { castRays(&pool); });
+	uint32_t numHits = 0;
+	for (auto e : rayHits) numHits += e != entt::null;
+	printf("  %u rays (100 units): %8.3f ms single threaded, %8.3f ms on %zu workers + caller, %u hits\n", numRays, raysSingle, raysPooled, pool.size(), numHits);
+	return missing + treeMissing;
+}
+int main()
+{
+	uint32_t missing = Run("dense world", 500.f);
+	missing += Run("open world", 5000.f);
+	return missing ? 1 : 0;
+}
@@ -0,0 +1,347 @@
+/*
+* CPU model of the gpu culling pass: GPUCull_cs and the HiZ shaders that build its depth pyramid, copied by hand. It
+* checks the culling math, not the shaders: nothing here compiles or dispatches them, so a change to either side has
+* to be copied to the other, and running the real pass on a headless device is still to do. Checks the decisions on
+* known setups (a wall in front of, beside and behind boxes, boxes behind the camera, past the far plane and crossing
+* the near plane), that the frustum test never drops a box BoundingFrustum keeps, that the pyramid never hides a box
+* the full resolution depth shows, and that every record's survivors are compacted from its own instance base without
+* touching any other record's instances.
+*/
+#include "Pistachio/Renderer/BufferHandles.h"
+#include "test_utils.h"
+#include <DirectXCollision.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Pistachio;
+using namespace DirectX;
+static constexpr uint32_t width = 320;//odd mip sizes further down the pyramid
+static constexpr uint32_t height = 180;
+static constexpr uint32_t numRandomBoxes = 20000;
+
+static XMMATRIX ViewProj()
+{
+	XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(0, 0, -10, 1), XMVectorSet(0, 0, 0, 1), XMVectorSet(0, 1, 0, 0));
+	return view * XMMatrixPerspectiveFovLH(XMConvertToRadians(60.f), (float)width / height, 0.1f, 100.f);
+}
+//(min, max) depth per texel of every mip, the first mip is half the depth buffer like DepthPyramid
+struct Pyramid
+{
+	uint32_t width = 0, height = 0;//first mip
+	std::vector<std::vector<XMFLOAT2>> mips;
+	uint32_t MipWidth(uint32_t mip) const { return std::max(width >> mip, 1u); }
+	uint32_t MipHeight(uint32_t mip) const { return std::max(height >> mip, 1u); }
+	XMFLOAT2 Load(uint32_t x, uint32_t y, uint32_t mip) const { return mips[mip][y * MipWidth(mip) + x]; }
+};
+//HiZFirstMip_cs and HiZDownsample_cs, an odd source folds its last row/column into the last texel
+template<typename Fn>
+static std::vector<XMFLOAT2> Reduce(uint32_t srcWidth, uint32_t srcHeight, uint32_t dstWidth, uint32_t dstHeight, Fn&& src)
+{
+	std::vector<XMFLOAT2> dst(dstWidth * dstHeight);
+	for (uint32_t ty = 0; ty < dstHeight; ty++)
+		for (uint32_t tx = 0; tx < dstWidth; tx++)
+		{
+			uint32_t lastX = tx == dstWidth - 1 ? srcWidth - 1 : std::min(tx * 2 + 1, srcWidth - 1);
+			uint32_t lastY = ty == dstHeight - 1 ? srcHeight - 1 : std::min(ty * 2 + 1, srcHeight - 1);
+			XMFLOAT2 result = { 1.f, 0.f };
+			for (uint32_t y = ty * 2; y <= lastY; y++)
+				for (uint32_t x = tx * 2; x <= lastX; x++)
+				{
+					XMFLOAT2 z = src(x, y);
+					result = { std::min(result.x, z.x), std::max(result.y, z.y) };
+				}
+			dst[ty * dstWidth + tx] = result;
+		}
+	return dst;
+}
+static Pyramid BuildPyramid(const std::vector<float>& depth)
+{
+	Pyramid pyramid;
+	pyramid.width = std::max(width / 2, 1u);
+	pyramid.height = std::max(height / 2, 1u);
+	//DepthPyramid::CountMips
+	uint32_t numMips = 1;
+	for (uint32_t size = std::max({ width / 2, height / 2, 1u }); size > 1; size /= 2) numMips++;
+	pyramid.mips.push_back(Reduce(width, height, pyramid.width, pyramid.height,
+		[&](uint32_t x, uint32_t y) { return XMFLOAT2(depth[y * width + x], depth[y * width + x]); }));
+	for (uint32_t mip = 1; mip < numMips; mip++)
+		pyramid.mips.push_back(Reduce(pyramid.MipWidth(mip - 1), pyramid.MipHeight(mip - 1), pyramid.MipWidth(mip), pyramid.MipHeight(mip),
+			[&](uint32_t x, uint32_t y) { return pyramid.Load(x, y, mip - 1); }));
+	return pyramid;
+}
+//GPUCull_cs
+struct CullInputs
+{
+	std::vector<BoundingBox> objects;//the gpu scene's bounds, by object id
+	std::vector<uint32_t> candidates;//the instance buffer
+	std::vector<DrawRecord> records;
+	bool occlusion = false;
+	XMMATRIX viewProj = XMMatrixIdentity();
+	XMMATRIX pyramidViewProj = XMMatrixIdentity();
+	const Pyramid* pyramid = nullptr;
+};
+static void GetPlanes(FXMMATRIX viewProj, XMVECTOR planes[6])
+{
+	//clip space planes of the camera, vectors are rows so the planes come from the columns
+	XMMATRIX m = XMMatrixTranspose(viewProj);
+	planes[0] = m.r[3] + m.r[0];
+	planes[1] = m.r[3] - m.r[0];
+	planes[2] = m.r[3] + m.r[1];
+	planes[3] = m.r[3] - m.r[1];
+	planes[4] = m.r[2];
+	planes[5] = m.r[3] - m.r[2];
+}
+static bool IsVisible(const XMVECTOR planes[6], const BoundingBox& box)
+{
+	XMVECTOR center = XMLoadFloat3(&box.Center), extents = XMLoadFloat3(&box.Extents);
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		float radius = XMVectorGetX(XMVector3Dot(extents, XMVectorAbs(planes[i])));
+		if (XMVectorGetX(XMVector3Dot(center, planes[i])) + XMVectorGetW(planes[i]) < -radius) return false;
+	}
+	return true;
+}
+//the box's rectangle in uv and its nearest depth, false when it crosses the near plane
+static bool Project(FXMMATRIX viewProj, const BoundingBox& box, XMFLOAT2& uvMin, XMFLOAT2& uvMax, float& nearest)
+{
+	XMFLOAT2 ndcMin = { 1, 1 }, ndcMax = { -1, -1 };
+	nearest = 1;
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		XMFLOAT3 corner = { box.Center.x + box.Extents.x * ((i & 1) ? 1 : -1), box.Center.y + box.Extents.y * ((i & 2) ? 1 : -1),
+			box.Center.z + box.Extents.z * ((i & 4) ? 1 : -1) };
+		XMFLOAT4 clip;
+		XMStoreFloat4(&clip, XMVector4Transform(XMVectorSet(corner.x, corner.y, corner.z, 1), viewProj));
+		if (clip.w <= 0) return false;
+		ndcMin = { std::min(ndcMin.x, clip.x / clip.w), std::min(ndcMin.y, clip.y / clip.w) };
+		ndcMax = { std::max(ndcMax.x, clip.x / clip.w), std::max(ndcMax.y, clip.y / clip.w) };
+		nearest = std::min(nearest, clip.z / clip.w);
+	}
+	auto saturate = [](float v) { return std::clamp(v, 0.f, 1.f); };
+	uvMin = { saturate(ndcMin.x * 0.5f + 0.5f), saturate(-ndcMax.y * 0.5f + 0.5f) };
+	uvMax = { saturate(ndcMax.x * 0.5f + 0.5f), saturate(-ndcMin.y * 0.5f + 0.5f) };
+	return true;
+}
+static bool IsOccluded(const CullInputs& in, const BoundingBox& box)
+{
+	XMFLOAT2 uvMin, uvMax;
+	float nearest;
+	//a box crossing the near plane covers too much of the screen to be worth testing
+	if (!Project(in.pyramidViewProj, box, uvMin, uvMax, nearest)) return false;
+	const Pyramid& p = *in.pyramid;
+	uint32_t numMips = (uint32_t)p.mips.size();
+	float sizeX = (uvMax.x - uvMin.x) * (float)p.width, sizeY = (uvMax.y - uvMin.y) * (float)p.height;
+	uint32_t mip = std::min((uint32_t)std::ceil(std::log2(std::max(std::max(sizeX, sizeY), 1.f))), numMips - 1);
+	uint32_t firstMinX = (uint32_t)(uvMin.x * (float)p.width), firstMinY = (uint32_t)(uvMin.y * (float)p.height);
+	uint32_t firstMaxX = (uint32_t)(uvMax.x * (float)p.width), firstMaxY = (uint32_t)(uvMax.y * (float)p.height);
+	if (mip > 0 && (firstMaxX >> (mip - 1)) - (firstMinX >> (mip - 1)) <= 1 && (firstMaxY >> (mip - 1)) - (firstMinY >> (mip - 1)) <= 1) mip--;
+	uint32_t mipWidth = p.MipWidth(mip), mipHeight = p.MipHeight(mip);
+	uint32_t minX = std::min(firstMinX >> mip, mipWidth - 1), minY = std::min(firstMinY >> mip, mipHeight - 1);
+	uint32_t maxX = std::min(firstMaxX >> mip, mipWidth - 1), maxY = std::min(firstMaxY >> mip, mipHeight - 1);
+	float farthest = 0;
+	for (uint32_t y = minY; y <= maxY; y++)
+		for (uint32_t x = minX; x <= maxX; x++)
+			farthest = std::max(farthest, p.Load(x, y, mip).y);
+	return nearest > farthest;
+}
+static bool Survives(const CullInputs& in, const XMVECTOR planes[6], uint32_t object)
+{
+	return IsVisible(planes, in.objects[object]) && !(in.occlusion && IsOccluded(in, in.objects[object]));
+}
+//one group per record, the threads are run one after another so the survivors keep their order
+static void Cull(const CullInputs& in, std::vector<DrawRecord>& culledArgs, std::vector<uint32_t>& culledObjects)
+{
+	XMVECTOR planes[6];
+	GetPlanes(in.viewProj, planes);
+	for (uint32_t record = 0; record < in.records.size(); record++)
+	{
+		DrawRecord draw = in.records[record];
+		uint32_t survivors = 0;
+		uint32_t base = draw.instanceBase;
+		for (uint32_t i = 0; i < draw.args.instanceCount; i++)
+		{
+			uint32_t object = in.candidates[base + i];
+			if (Survives(in, planes, object)) culledObjects[base + survivors++] = object;
+		}
+		draw.args.instanceCount = survivors;
+		culledArgs[record] = draw;
+	}
+}
+
+//a wall facing the camera, every pixel whose center it covers gets its depth
+static void DrawWall(std::vector<float>& depth, FXMMATRIX viewProj, XMFLOAT3 center, XMFLOAT2 halfSize)
+{
+	XMFLOAT2 uvMin, uvMax;
+	float wallDepth;
+	Project(viewProj, BoundingBox(center, { halfSize.x, halfSize.y, 0.f }), uvMin, uvMax, wallDepth);
+	for (uint32_t y = 0; y < height; y++)
+		for (uint32_t x = 0; x < width; x++)
+		{
+			float u = (x + 0.5f) / width, v = (y + 0.5f) / height;
+			if (u >= uvMin.x && u <= uvMax.x && v >= uvMin.y && v <= uvMax.y) depth[y * width + x] = std::min(depth[y * width + x], wallDepth);
+		}
+}
+//the full resolution depth over the box's rectangle, what the pyramid stands in for
+static bool IsOccludedFullRes(const std::vector<float>& depth, FXMMATRIX viewProj, const BoundingBox& box)
+{
+	XMFLOAT2 uvMin, uvMax;
+	float nearest;
+	if (!Project(viewProj, box, uvMin, uvMax, nearest)) return false;
+	uint32_t minX = std::min((uint32_t)(uvMin.x * width), width - 1), maxX = std::min((uint32_t)(uvMax.x * width), width - 1);
+	uint32_t minY = std::min((uint32_t)(uvMin.y * height), height - 1), maxY = std::min((uint32_t)(uvMax.y * height), height - 1);
+	float farthest = 0;
+	for (uint32_t y = minY; y <= maxY; y++)
+		for (uint32_t x = minX; x <= maxX; x++) farthest = std::max(farthest, depth[y * width + x]);
+	return nearest > farthest;
+}
+static uint32_t KnownSetups()
+{
+	uint32_t failures = 0;
+	printf("known setups\n");
+	std::vector<float> depth(width * height, 1.f);
+	DrawWall(depth, ViewProj(), { 0, 0, -5 }, { 4, 1.5f });
+	Pyramid pyramid = BuildPyramid(depth);
+	CullInputs in;
+	in.viewProj = in.pyramidViewProj = ViewProj();
+	in.occlusion = true;
+	in.pyramid = &pyramid;
+	XMVECTOR planes[6];
+	GetPlanes(in.viewProj, planes);
+	struct Case { const char* name; BoundingBox box; bool visible; bool occluded; };
+	const Case cases[] = {
+		{ "box behind the wall", BoundingBox({ 0, 0, 0 }, { 1, 1, 1 }), true, true },
+		{ "box beside the wall", BoundingBox({ 12, 0, 0 }, { 1, 1, 1 }), true, false },
+		{ "box sticking out above the wall", BoundingBox({ 0, 5, 0 }, { 1, 3, 1 }), true, false },
+		{ "box in front of the wall", BoundingBox({ 0, 0, -7 }, { 0.5f, 0.5f, 0.5f }), true, false },
+		{ "box intersecting the wall", BoundingBox({ 0, 0, -5 }, { 1, 1, 1 }), true, false },
+		{ "box crossing the near plane", BoundingBox({ 0, 0, -10 }, { 1, 1, 1 }), true, false },
+		{ "box behind the camera", BoundingBox({ 0, 0, -20 }, { 1, 1, 1 }), false, false },
+		{ "box far to the left", BoundingBox({ -60, 0, 0 }, { 1, 1, 1 }), false, false },
+		{ "box past the far plane", BoundingBox({ 0, 0, 200 }, { 1, 1, 1 }), false, false },
+	};
+	for (const Case& c : cases)
+	{
+		bool visible = IsVisible(planes, c.box);
+		bool occluded = visible && IsOccluded(in, c.box);
+		failures += Expect(c.name, visible == c.visible && occluded == c.occluded);
+	}
+	in.occlusion = false;
+	in.objects = { cases[0].box };
+	failures += Expect("occlusion off keeps the box behind the wall", Survives(in, planes, 0));
+	return failures;
+}
+//random boxes against the references, the gpu tests may keep more than they have to but never drop what they show
+static uint32_t AgainstReferences()
+{
+	uint32_t failures = 0;
+	std::mt19937 rng(17);
+	std::uniform_real_distribution<float> unit(0.f, 1.f);
+	XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(0, 0, -10, 1), XMVectorSet(0, 0, 0, 1), XMVectorSet(0, 1, 0, 0));
+	XMMATRIX proj = XMMatrixPerspectiveFovLH(XMConvertToRadians(60.f), (float)width / height, 0.1f, 100.f);
+	BoundingFrustum frustum(proj);
+	frustum.Transform(frustum, XMMatrixInverse(nullptr, view));
+	std::vector<float> depth(width * height, 1.f);
+	for (uint32_t i = 0; i < 12; i++)
+		DrawWall(depth, ViewProj(), { (unit(rng) - 0.5f) * 20.f, (unit(rng) - 0.5f) * 10.f, unit(rng) * 20.f - 5.f }, { 0.5f + unit(rng) * 3.f, 0.5f + unit(rng) * 3.f });
+	Pyramid pyramid = BuildPyramid(depth);
+	CullInputs in;
+	in.viewProj = in.pyramidViewProj = ViewProj();
+	in.pyramid = &pyramid;
+	XMVECTOR planes[6];
+	GetPlanes(in.viewProj, planes);
+	uint32_t droppedInside = 0, keptDisjoint = 0, rejectedTouching = 0;
+	uint32_t hiddenFullRes = 0, hiddenPyramid = 0, hiddenWrongly = 0;
+	for (uint32_t i = 0; i < numRandomBoxes; i++)
+	{
+		BoundingBox box({ (unit(rng) - 0.5f) * 160.f, (unit(rng) - 0.5f) * 90.f, unit(rng) * 140.f - 30.f },
+			{ 0.2f + unit(rng) * 3.f, 0.2f + unit(rng) * 3.f, 0.2f + unit(rng) * 3.f });
+		bool visible = IsVisible(planes, box);
+		ContainmentType containment = frustum.Contains(box);
+		droppedInside += !visible && containment == CONTAINS;
+		keptDisjoint += visible && containment == DISJOINT;
+		//a rejected box is outside one plane, a slightly smaller one can't touch the frustum
+		BoundingBox shrunk(box.Center, { box.Extents.x * 0.99f, box.Extents.y * 0.99f, box.Extents.z * 0.99f });
+		rejectedTouching += !visible && frustum.Contains(shrunk) != DISJOINT;
+		if (!visible) continue;
+		bool fullRes = IsOccludedFullRes(depth, in.pyramidViewProj, box);
+		bool coarse = IsOccluded(in, box);
+		hiddenFullRes += fullRes;
+		hiddenPyramid += coarse;
+		hiddenWrongly += coarse && !fullRes;
+	}
+	printf("%u random boxes, %ux%u depth, %zu pyramid mips\n", numRandomBoxes, width, height, pyramid.mips.size());
+	printf("  frustum planes keep %u boxes BoundingFrustum finds disjoint (corners, allowed)\n", keptDisjoint);
+	printf("  full resolution depth hides %u boxes, the pyramid %u\n", hiddenFullRes, hiddenPyramid);
+	failures += Expect("no box inside the frustum is dropped", droppedInside == 0);
+	failures += Expect("every dropped box is outside the frustum", rejectedTouching == 0);
+	failures += Expect("the pyramid never hides a box the full depth shows", hiddenWrongly == 0);
+	failures += Expect("the pyramid hides boxes at all", hiddenPyramid > 0);
+	return failures;
+}
+//prepass and opaque records over one instance buffer, survivors stay inside their own record's range
+static uint32_t Compaction()
+{
+	uint32_t failures = 0;
+	printf("compaction\n");
+	std::vector<float> depth(width * height, 1.f);
+	DrawWall(depth, ViewProj(), { 0, 0, -5 }, { 4, 1.5f });
+	Pyramid pyramid = BuildPyramid(depth);
+	CullInputs in;
+	in.viewProj = in.pyramidViewProj = ViewProj();
+	in.occlusion = true;
+	in.pyramid = &pyramid;
+	//visible, behind the wall, behind the camera
+	for (float x = -3; x <= 3; x += 1.f)
+	{
+		in.objects.push_back(BoundingBox({ x, 3.f, 0 }, { 0.3f, 0.3f, 0.3f }));
+		in.objects.push_back(BoundingBox({ x, 0, 0 }, { 0.3f, 0.3f, 0.3f }));
+		in.objects.push_back(BoundingBox({ x, 0, -30 }, { 0.3f, 0.3f, 0.3f }));
+	}
+	uint32_t numObjects = (uint32_t)in.objects.size();
+	//two prepass records, then three opaque ones, the last is empty, every record's instances start at its instance base
+	uint32_t counts[5] = { 9, 12, 8, 13, 0 };
+	for (uint32_t r = 0; r < 5; r++)
+	{
+		in.records.push_back({ { 36, counts[r], r * 36, (int32_t)(r * 24), 0 }, (uint32_t)in.candidates.size() });
+		for (uint32_t i = 0; i < counts[r]; i++) in.candidates.push_back((r * 7 + i * 5) % numObjects);
+	}
+	constexpr uint32_t untouched = UINT32_MAX;
+	std::vector<DrawRecord> culledArgs(in.records.size());
+	std::vector<uint32_t> culledObjects(in.candidates.size(), untouched);
+	Cull(in, culledArgs, culledObjects);
+	XMVECTOR planes[6];
+	GetPlanes(in.viewProj, planes);
+	bool argsKept = true, survivorsRight = true, restUntouched = true;
+	uint32_t kept = 0;
+	for (uint32_t r = 0; r < in.records.size(); r++)
+	{
+		const DrawRecord& before = in.records[r];
+		const DrawRecord& after = culledArgs[r];
+		argsKept &= after.args.indexCount == before.args.indexCount && after.args.firstIndex == before.args.firstIndex &&
+			after.args.vertexOffset == before.args.vertexOffset && after.args.firstInstance == 0 && after.instanceBase == before.instanceBase;
+		uint32_t base = before.instanceBase;
+		std::vector<uint32_t> expected;
+		for (uint32_t i = 0; i < before.args.instanceCount; i++)
+			if (Survives(in, planes, in.candidates[base + i])) expected.push_back(in.candidates[base + i]);
+		survivorsRight &= after.args.instanceCount == expected.size() &&
+			std::equal(expected.begin(), expected.end(), culledObjects.begin() + base);
+		for (uint32_t i = base + after.args.instanceCount; i < base + before.args.instanceCount; i++) restUntouched &= culledObjects[i] == untouched;
+		kept += after.args.instanceCount;
+	}
+	printf("  %zu records, %zu instances, %u kept\n", in.records.size(), in.candidates.size(), kept);
+	failures += Expect("every record keeps its arguments and instance base", argsKept);
+	failures += Expect("survivors are packed from the record's instance base", survivorsRight);
+	failures += Expect("nothing is written past a record's survivors", restUntouched);
+	failures += Expect("some instances are culled and some kept", kept > 0 && kept < in.candidates.size());
+	return failures;
+}
+int main()
+{
+	uint32_t failures = KnownSetups();
+	failures += AgainstReferences();
+	failures += Compaction();
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,228 @@
+/*
+* Compares transform propagation between the old per-entity child vector layout
+* and the flattened TransformHierarchy on 100k node trees, then measures how the
+* threaded update (propagation + object constant math) scales with the worker count
+* and what change driven object constants save when most of the scene is static
+*/
+#include "Pistachio/Scene/TransformHierarchy.h"
+#include "test_utils.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <random>
+#include <vector>
+
+using namespace Pistachio;
+static constexpr uint32_t numNodes = 100000;
+static constexpr uint32_t numIterations = 20;
+
+struct LegacyNode
+{
+	std::vector<uint32_t> children;
+	DirectX::XMMATRIX local;
+	DirectX::XMMATRIX world;
+};
+static uint32_t LegacyUpdate(std::vector<LegacyNode>& nodes, uint32_t node, DirectX::FXMMATRIX parent)
+{
+	nodes[node].world = nodes[node].local * parent;
+	uint32_t count = 1;
+	for (auto child : nodes[node].children)
+		count += LegacyUpdate(nodes, child, nodes[node].world);
+	return count;
+}
+//builds the same random tree in both layouts, @maxFanout controls how deep it gets
+static void Run(const char* name, uint32_t maxFanout)
+{
+	std::mt19937 rng(42);
+	std::vector<uint32_t> parents(numNodes, TransformHierarchy::InvalidNode);
+	for (uint32_t i = 1; i < numNodes; i++)
+	{
+		uint32_t lo = i > maxFanout ? i - maxFanout : 0;
+		parents[i] = std::uniform_int_distribution<uint32_t>(lo, i - 1)(rng);
+	}
+	std::vector<LegacyNode> legacy(numNodes);
+	//the legacy nodes are allocated in a shuffled order, like entities created over time
+	std::vector<uint32_t> remap(numNodes);
+	for (uint32_t i = 0; i < numNodes; i++) remap[i] = i;
+	std::shuffle(remap.begin() + 1, remap.end(), rng);
+	TransformHierarchy hierarchy;
+	std::vector<uint32_t> handles(numNodes);
+	std::vector<DirectX::XMMATRIX> locals(numNodes);
+	std::vector<DirectX::XMMATRIX> worlds(numNodes);
+	for (uint32_t i = 0; i < numNodes; i++)
+	{
+		locals[i] = DirectX::XMMatrixTranslation((float)(i % 7), 1.f, 0.f);
+		legacy[remap[i]].local = locals[i];
+		if (i) legacy[remap[parents[i]]].children.push_back(remap[i]);
+		handles[i] = hierarchy.CreateNode((entt::entity)i, i ? handles[parents[i]] : TransformHierarchy::InvalidNode);
+	}
+	auto propagate = [&]()
+		{
+			return hierarchy.Propagate([&](entt::entity e, DirectX::FXMMATRIX parent)
+				{
+					worlds[(uint32_t)e] = locals[(uint32_t)e] * parent;
+					return worlds[(uint32_t)e];
+				});
+		};
+	propagate();
+
+	double legacyFull = Time(numIterations, [&]() { LegacyUpdate(legacy, remap[0], DirectX::XMMatrixIdentity()); });
+	double flatFull = Time(numIterations, [&]() { hierarchy.MarkDirty(handles[0]); propagate(); });
+	uint32_t mismatches = 0;
+	for (uint32_t i = 0; i < numNodes; i++)
+	{
+		if (!DirectX::XMVector4NearEqual(worlds[i].r[3], legacy[remap[i]].world.r[3], DirectX::XMVectorReplicate(1e-3f))) mismatches++;
+	}
+	double flatStatic = Time(numIterations, [&]() { propagate(); });
+	//1% of the nodes move every frame
+	std::vector<uint32_t> moving;
+	for (uint32_t i = 0; i < numNodes / 100; i++) moving.push_back(std::uniform_int_distribution<uint32_t>(1, numNodes - 1)(rng));
+	uint32_t touched = 0;
+	double flatPartial = Time(numIterations, [&]() { for (auto n : moving) hierarchy.MarkDirty(handles[n]); touched = propagate(); });
+	//nodes are created after their parents, so the last ones are leaves and only their own subtrees are walked
+	uint32_t leavesTouched = 0;
+	double flatLeaves = Time(numIterations, [&]() { for (uint32_t i = numNodes - 16; i < numNodes; i++) hierarchy.MarkDirty(handles[i]); leavesTouched = propagate(); });
+	std::vector<entt::entity> removed;
+	auto start = std::chrono::high_resolution_clock::now();
+	hierarchy.DestroySubtree(handles[numNodes / 2], removed);
+	double destroy = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	hierarchy.Reparent(handles[numNodes / 3], handles[1]);
+	double rebuild = Time(numIterations, [&]() { hierarchy.Reparent(handles[numNodes / 3], handles[numNodes / 4]); propagate(); });
+
+	printf("%s (%u levels, %u mismatching nodes)\n", name, hierarchy.GetNumLevels(), mismatches);
+	printf("  full update:     child vectors %8.3f ms | flat sweep %8.3f ms\n", legacyFull, flatFull);
+	printf("  1%% dirty:        flat sweep %8.3f ms (%u nodes recomputed)\n", flatPartial, touched);
+	printf("  16 leaves dirty: subtree walk %8.3f ms (%u nodes recomputed)\n", flatLeaves, leavesTouched);
+	printf("  static frame:    flat sweep %8.3f ms\n", flatStatic);
+	printf("  destroy subtree: %8.3f ms (%zu nodes)\n", destroy, removed.size());
+	printf("  reparent + sweep rebuild: %8.3f ms\n", rebuild);
+}
+//same work as Scene::UpdateTransforms followed by the math half of Scene::UpdateObjectCBs
+static void RunScaling(uint32_t maxFanout)
+{
+	std::mt19937 rng(7);
+	TransformHierarchy hierarchy;
+	std::vector<uint32_t> handles(numNodes);
+	std::vector<DirectX::XMMATRIX> locals(numNodes);
+	std::vector<DirectX::XMMATRIX> worlds(numNodes);
+	std::vector<DirectX::XMFLOAT4X4> objectData(numNodes * 2);
+	for (uint32_t i = 0; i < numNodes; i++)
+	{
+		uint32_t lo = i > maxFanout ? i - maxFanout : 0;
+		uint32_t parent = i ? std::uniform_int_distribution<uint32_t>(lo, i - 1)(rng) : 0;
+		locals[i] = DirectX::XMMatrixRotationY((float)i) * DirectX::XMMatrixTranslation((float)(i % 7), 1.f, 0.f);
+		handles[i] = hierarchy.CreateNode((entt::entity)i, i ? handles[parent] : TransformHierarchy::InvalidNode);
+	}
+	auto frame = [&](ThreadPool* pool)
+		{
+			hierarchy.MarkDirty(handles[0]);
+			hierarchy.Propagate([&](entt::entity e, DirectX::FXMMATRIX parent)
+				{
+					worlds[(uint32_t)e] = locals[(uint32_t)e] * parent;
+					return worlds[(uint32_t)e];
+				}, pool);
+			ParallelFor(pool, numNodes, 512, [&](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t i = begin; i < end; i++)
+					{
+						DirectX::XMStoreFloat4x4(&objectData[i * 2], DirectX::XMMatrixTranspose(worlds[i]));
+						DirectX::XMStoreFloat4x4(&objectData[i * 2 + 1], DirectX::XMMatrixInverse(nullptr, worlds[i]));
+					}
+				});
+		};
+	frame(nullptr);
+	std::vector<DirectX::XMFLOAT4X4> reference = objectData;
+	double single = Time(numIterations, [&]() { frame(nullptr); });
+	printf("threaded update (%u levels)\n", hierarchy.GetNumLevels());
+	//powers of two, then every hardware thread
+	uint32_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+	std::vector<uint32_t> threadCounts;
+	for (uint32_t threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+	threadCounts.push_back(maxThreads);
+	for (uint32_t threads : threadCounts)
+	{
+		//the calling thread always takes part, so the pool holds one less worker
+		auto pool = std::make_unique<ThreadPool>(threads - 1);
+		frame(pool.get());
+		double ms = Time(numIterations, [&]() { frame(pool.get()); });
+		bool identical = memcmp(reference.data(), objectData.data(), reference.size() * sizeof(DirectX::XMFLOAT4X4)) == 0;
+		printf("  %2u threads: %8.3f ms (%.2fx, output %s)\n", threads, ms, single / ms, identical ? "identical" : "DIFFERS");
+	}
+}
+//object constants rebuilt for every node against only the nodes propagation touched, like Scene::UpdateObjectCBs
+static void RunChangeDriven(uint32_t maxFanout)
+{
+	std::mt19937 rng(11);
+	TransformHierarchy hierarchy;
+	std::vector<uint32_t> handles(numNodes);
+	std::vector<DirectX::XMMATRIX> locals(numNodes);
+	std::vector<DirectX::XMMATRIX> worlds(numNodes);
+	std::vector<uint8_t> dirty(numNodes, 1);
+	std::vector<uint32_t> changed;
+	std::vector<DirectX::XMFLOAT4X4> objectData(numNodes * 2);
+	for (uint32_t i = 0; i < numNodes; i++)
+	{
+		uint32_t lo = i > maxFanout ? i - maxFanout : 0;
+		uint32_t parent = i ? std::uniform_int_distribution<uint32_t>(lo, i - 1)(rng) : 0;
+		locals[i] = DirectX::XMMatrixRotationY((float)i) * DirectX::XMMatrixTranslation((float)(i % 7), 1.f, 0.f);
+		handles[i] = hierarchy.CreateNode((entt::entity)i, i ? handles[parent] : TransformHierarchy::InvalidNode);
+	}
+	auto propagate = [&]()
+		{
+			hierarchy.Propagate([&](entt::entity e, DirectX::FXMMATRIX parent)
+				{
+					worlds[(uint32_t)e] = locals[(uint32_t)e] * parent;
+					dirty[(uint32_t)e] = 1;
+					return worlds[(uint32_t)e];
+				});
+		};
+	auto write = [&](uint32_t i)
+		{
+			DirectX::XMStoreFloat4x4(&objectData[i * 2], DirectX::XMMatrixTranspose(worlds[i]));
+			DirectX::XMStoreFloat4x4(&objectData[i * 2 + 1], DirectX::XMMatrixInverse(nullptr, worlds[i]));
+		};
+	propagate();
+	for (uint32_t i = 0; i < numNodes; i++) write(i);
+	std::fill(dirty.begin(), dirty.end(), 0);
+	//leaves near the end of the creation order move, so subtrees stay small
+	std::vector<uint32_t> moving;
+	for (uint32_t i = 0; i < numNodes / 100; i++) moving.push_back(std::uniform_int_distribution<uint32_t>(numNodes / 2, numNodes - 1)(rng));
+	double full = Time(numIterations, [&]()
+		{
+			for (auto n : moving) hierarchy.MarkDirty(handles[n]);
+			propagate();
+			for (uint32_t i = 0; i < numNodes; i++) write(i);
+			std::fill(dirty.begin(), dirty.end(), 0);
+		});
+	uint32_t uploads = 0;
+	double changeDriven = Time(numIterations, [&]()
+		{
+			for (auto n : moving) hierarchy.MarkDirty(handles[n]);
+			propagate();
+			changed.clear();
+			for (uint32_t i = 0; i < numNodes; i++) if (dirty[i]) changed.push_back(i);
+			for (auto i : changed) { write(i); dirty[i] = 0; }
+			uploads = (uint32_t)changed.size();
+		});
+	double idle = Time(numIterations, [&]()
+		{
+			propagate();
+			changed.clear();
+			for (uint32_t i = 0; i < numNodes; i++) if (dirty[i]) changed.push_back(i);
+		});
+	printf("object constants, 1%% of the nodes moving\n");
+	printf("  every object:       %8.3f ms (%u uploads)\n", full, numNodes);
+	printf("  changed objects:    %8.3f ms (%u uploads)\n", changeDriven, uploads);
+	printf("  nothing moved:      %8.3f ms (0 uploads)\n", idle);
+}
+int main()
+{
+	Run("wide tree", 2000);
+	Run("deep tree", 8);
+	RunScaling(2000);
+	RunChangeDriven(2000);
+	return 0;
+}
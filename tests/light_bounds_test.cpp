@@ -0,0 +1,71 @@
+/*
+* Duplicates a point light the way Scene::DuplicateEntity does, by emplacing a copy of its component, with the
+* construct and destroy hooks the scene connects. The stand-in light copies its tree leaf like a defaulted copy
+* would, the construct hook alone has to give the duplicate a leaf of its own, and destroying both lights must
+* leave the tree empty instead of removing one leaf twice.
+*/
+#include "Pistachio/Scene/LightBounds.h"
+#include "test_utils.h"
+#include <cstdio>
+
+using namespace Pistachio;
+using namespace DirectX;
+//the parts of a LightComponent the scene's tree bookkeeping touches
+struct Light
+{
+	float range = 5.f;
+	uint32_t treeNode = AABBTree::InvalidNode;
+};
+struct LightScene
+{
+	entt::registry registry;
+	AABBTree tree;
+	LightScene()
+	{
+		registry.on_construct<Light>().connect<&LightScene::OnLightAdded>(*this);
+		registry.on_destroy<Light>().connect<&LightScene::OnLightRemoved>(*this);
+	}
+	void OnLightAdded(entt::registry& reg, entt::entity e) { LightBounds::Reset(reg.get<Light>(e)); }
+	void OnLightRemoved(entt::registry& reg, entt::entity e) { LightBounds::Remove(tree, reg.get<Light>(e)); }
+	//Scene::SyncLightBounds for one light at @position
+	void Sync(entt::entity e, XMFLOAT3 position)
+	{
+		auto& light = registry.get<Light>(e);
+		BoundingBox box;
+		BoundingBox::CreateFromSphere(box, BoundingSphere(position, light.range));
+		LightBounds::Sync(tree, light, e, box, 1);
+	}
+	uint32_t CountOverlaps(entt::entity e)
+	{
+		uint32_t count = 0;
+		tree.QueryOverlap([](const XMFLOAT3&, const XMFLOAT3&) { return true; }, ~0u, [&](entt::entity hit, uint32_t) { count += hit == e; });
+		return count;
+	}
+};
+
+int main()
+{
+	uint32_t failures = 0;
+	LightScene scene;
+	entt::entity original = scene.registry.create();
+	scene.registry.emplace<Light>(original);
+	scene.Sync(original, XMFLOAT3(0, 0, 0));
+
+	entt::entity duplicate = scene.registry.create();
+	scene.registry.emplace<Light>(duplicate, scene.registry.get<Light>(original));
+	auto& copy = scene.registry.get<Light>(duplicate);
+	failures += Expect("the duplicate starts without a leaf", copy.treeNode == AABBTree::InvalidNode);
+	failures += Expect("the duplicate keeps the light's data", copy.range == scene.registry.get<Light>(original).range);
+
+	scene.Sync(duplicate, XMFLOAT3(100, 0, 0));
+	scene.Sync(original, XMFLOAT3(0, 50, 0));
+	failures += Expect("each light has its own leaf", scene.registry.get<Light>(original).treeNode != copy.treeNode);
+	failures += Expect("the tree holds both lights", scene.tree.GetNumLeaves() == 2);
+	failures += Expect("both lights are found once", scene.CountOverlaps(original) == 1 && scene.CountOverlaps(duplicate) == 1);
+
+	scene.registry.destroy(original);
+	failures += Expect("destroying the original keeps the duplicate's leaf", scene.tree.GetNumLeaves() == 1 && scene.CountOverlaps(duplicate) == 1);
+	scene.registry.destroy(duplicate);
+	failures += Expect("destroying both empties the tree", scene.tree.GetNumLeaves() == 0);
+	return failures ? 1 : 0;
+}
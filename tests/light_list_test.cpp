@@ -0,0 +1,78 @@
+/*
+* Uploads a night city's worth of lights every frame through LightListLayout::Upload, the call Scene::UpdateLightsBuffer
+* makes, into a stand-in for the light list buffer that counts its maps. Heap allocations are counted with a replaced
+* operator new: writing at the final offsets allocates nothing. Also checks that the lights land where the shaders
+* step through them, that an empty scene doesn't map the buffer, and times the upload.
+*/
+#include "Pistachio/Renderer/LightListLayout.h"
+#include "test_utils.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <vector>
+
+using namespace Pistachio;
+static std::atomic<uint64_t> numAllocations = 0;
+void* operator new(std::size_t size)
+{
+	numAllocations++;
+	if (void* p = std::malloc(size ? size : 1)) return p;
+	throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+static constexpr uint32_t numRegular = 4000;
+static constexpr uint32_t numShadow = 64;
+static constexpr uint32_t numFrames = 240;
+
+//the parts of an RHI buffer the upload touches, a map has to be matched by an unmap
+struct MappedBuffer
+{
+	std::vector<uint8_t> bytes;
+	uint32_t numMaps = 0;
+	uint32_t numUnmaps = 0;
+	std::optional<void*> Map() { numMaps++; return bytes.data(); }
+	void UnMap() { numUnmaps++; }
+};
+int main()
+{
+	uint32_t failures = 0;
+	//the scene keeps these between frames and only clears them
+	std::vector<Light> regular(numRegular);
+	std::vector<ShadowCastingLight> shadow(numShadow);
+	for (uint32_t i = 0; i < numRegular; i++) regular[i].position = { (float)i, 0.f, 0.f };
+	for (uint32_t i = 0; i < numShadow; i++) shadow[i].light.position = { (float)i, 1.f, 0.f };
+	MappedBuffer buffer;
+	buffer.bytes.resize(LightListLayout::GetSize(numRegular, numShadow));
+
+	printf("layout\n");
+	uint32_t written = LightListLayout::Upload(&buffer, regular, shadow);
+	failures += Expect("every byte of the list is written", written == buffer.bytes.size());
+	failures += Expect("the buffer is mapped and unmapped once", buffer.numMaps == 1 && buffer.numUnmaps == 1);
+	//the shaders read a light's position from the first float4 at its stride
+	const float* floats = reinterpret_cast<const float*>(buffer.bytes.data());
+	uint32_t regularIndex = 1234 * (LightListLayout::RegularStride / 16) * 4;
+	uint32_t shadowIndex = (numRegular * (LightListLayout::RegularStride / 16) + 17 * (LightListLayout::ShadowStride / 16)) * 4;
+	failures += Expect("a regular light sits at its shader stride", floats[regularIndex] == 1234.f);
+	failures += Expect("a shadow light sits after every regular light", floats[shadowIndex] == 17.f && floats[shadowIndex + 1] == 1.f);
+	MappedBuffer empty;
+	written = LightListLayout::Upload(&empty, std::span<const Light>(), std::span<const ShadowCastingLight>());
+	failures += Expect("a scene without lights doesn't map the buffer", written == 0 && empty.numMaps == 0);
+
+	printf("%u frames of %u regular and %u shadow casting lights\n", numFrames, numRegular, numShadow);
+	buffer.numMaps = buffer.numUnmaps = 0;
+	uint64_t before = numAllocations;
+	auto start = std::chrono::high_resolution_clock::now();
+	for (uint32_t frame = 0; frame < numFrames; frame++) LightListLayout::Upload(&buffer, regular, shadow);
+	auto end = std::chrono::high_resolution_clock::now();
+	uint64_t allocations = numAllocations - before;
+	double ms = std::chrono::duration<double, std::milli>(end - start).count();
+	printf("  %4llu allocations, %6.3f ms per frame\n", (unsigned long long)allocations, ms / numFrames);
+	failures += Expect("uploading never allocates", allocations == 0);
+	failures += Expect("one map per frame", buffer.numMaps == numFrames && buffer.numUnmaps == numFrames);
+	return failures ? 1 : 0;
+}
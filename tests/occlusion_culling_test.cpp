@@ -0,0 +1,123 @@
+/*
+* Checks the masked software occlusion culler against known setups (a wall in front of, beside and behind
+* boxes, a wall with a gap) and times rasterizing occluders and testing boxes on a scattered city block
+*/
+#include "Pistachio/Scene/MaskedOcclusionCuller.h"
+#include "test_utils.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Pistachio;
+using namespace DirectX;
+static constexpr uint32_t width = 256;
+static constexpr uint32_t height = 128;
+
+//unit cube from -1 to 1, 12 triangles
+static const XMFLOAT3 cubeVertices[8] = {
+	{ -1, -1, -1 }, { 1, -1, -1 }, { 1, 1, -1 }, { -1, 1, -1 },
+	{ -1, -1, 1 }, { 1, -1, 1 }, { 1, 1, 1 }, { -1, 1, 1 },
+};
+static const uint32_t cubeIndices[36] = {
+	0, 1, 2, 0, 2, 3, 4, 6, 5, 4, 7, 6,
+	0, 4, 5, 0, 5, 1, 3, 2, 6, 3, 6, 7,
+	0, 3, 7, 0, 7, 4, 1, 5, 6, 1, 6, 2,
+};
+static XMMATRIX ViewProj()
+{
+	XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(0, 0, -10, 1), XMVectorSet(0, 0, 0, 1), XMVectorSet(0, 1, 0, 0));
+	return view * XMMatrixPerspectiveFovLH(XMConvertToRadians(60.f), (float)width / height, 0.1f, 100.f);
+}
+//a box from @center scaled by @extents
+static void DrawBox(MaskedOcclusionCuller& culler, XMFLOAT3 center, XMFLOAT3 extents)
+{
+	XMMATRIX world = XMMatrixScaling(extents.x, extents.y, extents.z) * XMMatrixTranslation(center.x, center.y, center.z);
+	culler.RenderTriangles(&cubeVertices[0].x, 8, sizeof(XMFLOAT3), cubeIndices, 36, world);
+}
+static uint32_t KnownSetups()
+{
+	MaskedOcclusionCuller culler;
+	culler.SetResolution(width, height);
+	uint32_t failures = 0;
+	printf("known setups\n");
+	//a wide wall 5 units in front of the camera
+	culler.Begin(ViewProj());
+	DrawBox(culler, { 0, 0, -5 }, { 4, 1.5f, 0.1f });
+	failures += Expect("box behind the wall", culler.IsOccluded(BoundingBox({ 0, 0, 0 }, { 1, 1, 1 })));
+	failures += Expect("box beside the wall", !culler.IsOccluded(BoundingBox({ 12, 0, 0 }, { 1, 1, 1 })));
+	failures += Expect("box sticking out above the wall", !culler.IsOccluded(BoundingBox({ 0, 5, 0 }, { 1, 3, 1 })));
+	failures += Expect("box in front of the wall", !culler.IsOccluded(BoundingBox({ 0, 0, -7 }, { 0.5f, 0.5f, 0.5f })));
+	failures += Expect("box intersecting the wall", !culler.IsOccluded(BoundingBox({ 0, 0, -5 }, { 1, 1, 1 })));
+	failures += Expect("box crossing the near plane", !culler.IsOccluded(BoundingBox({ 0, 0, -10 }, { 1, 1, 1 })));
+	//the wall's center sits at depth of the box it occludes, the buffer must never be nearer than the wall
+	float wallDepth = culler.GetPixelDepth(width / 2, height / 2);
+	XMVECTOR wallClip = XMVector3TransformCoord(XMVectorSet(0, 0, -5.1f, 1), ViewProj());
+	failures += Expect("buffer depth is not nearer than the wall", wallDepth >= XMVectorGetZ(wallClip));
+	failures += Expect("empty pixels stay at the far plane", culler.GetPixelDepth(0, 0) == 1.f);
+
+	//two walls with a gap between them, a box seen through the gap is visible
+	culler.Begin(ViewProj());
+	DrawBox(culler, { -3, 0, -5 }, { 2.5f, 3, 0.1f });
+	DrawBox(culler, { 3, 0, -5 }, { 2.5f, 3, 0.1f });
+	failures += Expect("box seen through a gap", !culler.IsOccluded(BoundingBox({ 0, 0, 0 }, { 0.3f, 0.3f, 0.3f })));
+	failures += Expect("box behind one side of the gap", culler.IsOccluded(BoundingBox({ -3, 0, 0 }, { 0.5f, 0.5f, 0.5f })));
+
+	//a wall made of many small triangles must hide as much as a single quad
+	culler.Begin(ViewProj());
+	for (int y = -3; y < 3; y++)
+		for (int x = -4; x < 4; x++)
+			DrawBox(culler, { x + 0.5f, y + 0.5f, -5 }, { 0.5f, 0.5f, 0.1f });
+	failures += Expect("box behind a tiled wall", culler.IsOccluded(BoundingBox({ 0, 0, 0 }, { 1, 1, 1 })));
+
+	//a wall tilted away from the camera, the box behind its far edge is still hidden
+	culler.Begin(ViewProj());
+	culler.RenderTriangles(&cubeVertices[0].x, 8, sizeof(XMFLOAT3), cubeIndices, 36,
+		XMMatrixScaling(4, 3, 0.1f) * XMMatrixRotationY(XMConvertToRadians(40.f)) * XMMatrixTranslation(0, 0, -4));
+	failures += Expect("box behind a tilted wall", culler.IsOccluded(BoundingBox({ 0, 0, 2 }, { 0.5f, 0.5f, 0.5f })));
+	return failures;
+}
+//a grid of buildings seen from street level, each building occludes and is tested
+static void Timings()
+{
+	constexpr uint32_t numFrames = 20;
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<float> unit(0.f, 1.f);
+	std::vector<BoundingBox> buildings;
+	for (int z = 0; z < 20; z++)
+		for (int x = -10; x < 10; x++)
+			buildings.emplace_back(XMFLOAT3(x * 8.f, 0, z * 8.f), XMFLOAT3(2.f + unit(rng) * 2.f, 2.f + unit(rng) * 10.f, 2.f + unit(rng) * 2.f));
+	std::vector<BoundingBox> props;
+	for (uint32_t i = 0; i < 10000; i++)
+		props.emplace_back(XMFLOAT3((unit(rng) - 0.5f) * 160.f, unit(rng), unit(rng) * 160.f), XMFLOAT3(0.5f, 0.5f, 0.5f));
+	XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(4, 1.7f, -10, 1), XMVectorSet(4, 1.7f, 0, 1), XMVectorSet(0, 1, 0, 0));
+	XMMATRIX viewProj = view * XMMatrixPerspectiveFovLH(XMConvertToRadians(60.f), (float)width / height, 0.1f, 500.f);
+
+	MaskedOcclusionCuller culler;
+	culler.SetResolution(width, height);
+	double raster = 0.0, test = 0.0;
+	uint32_t occluded = 0;
+	for (uint32_t frame = 0; frame < numFrames; frame++)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		culler.Begin(viewProj);
+		for (const BoundingBox& b : buildings) DrawBox(culler, b.Center, b.Extents);
+		auto mid = std::chrono::high_resolution_clock::now();
+		occluded = 0;
+		for (const BoundingBox& b : props) occluded += culler.IsOccluded(b);
+		auto end = std::chrono::high_resolution_clock::now();
+		raster += std::chrono::duration<double, std::milli>(mid - start).count();
+		test += std::chrono::duration<double, std::milli>(end - mid).count();
+	}
+	const auto& stats = culler.GetStats();
+	printf("city block, %ux%u buffer\n", width, height);
+	printf("  rasterize %zu occluders: %8.3f ms per frame (%u triangles drawn, %u skipped, %u tile updates)\n",
+		buildings.size(), raster / numFrames, stats.numTrianglesRasterized, stats.numTrianglesSkipped, stats.numTileUpdates);
+	printf("  test %zu boxes:          %8.3f ms per frame, %u occluded\n", props.size(), test / numFrames, occluded);
+}
+int main()
+{
+	uint32_t failures = KnownSetups();
+	Timings();
+	return failures ? 1 : 0;
+}
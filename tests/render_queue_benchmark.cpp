@@ -0,0 +1,349 @@
+/*
+* Builds a frame worth of opaque draws in visibility order, then compares the pipeline and material
+* switches a forward pass makes with and without the RenderQueue sort, and times the radix sort against std::stable_sort.
+* A second scene of 10k instances of a few meshes compares the draw calls and the command recording time
+* of one draw per mesh against one instanced draw per batch, and against indirect submission with one call per material.
+* A third compares the shadow casters of a directional light split in one list per cascade against single pass cascades,
+* where a caster is one batch instance per cascade it touches.
+*/
+#include "Pistachio/Renderer/BufferHandles.h"
+#include "Pistachio/Renderer/RenderQueue.h"
+#include "test_utils.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Pistachio;
+static constexpr uint32_t numDraws = 20000;
+static constexpr uint32_t numShaders = 8;
+static constexpr uint32_t numMaterials = 300;
+static constexpr uint32_t numMeshes = 500;
+static constexpr uint32_t numIterations = 50;
+static constexpr uint32_t numInstances = 10000;
+static constexpr uint32_t numInstancedMeshes = 40;
+static constexpr uint32_t numInstancedMaterials = 10;
+static constexpr uint32_t numCasters = 5000;
+static constexpr uint32_t numCascades = 4;
+
+struct Draw
+{
+	uint32_t shader;
+	uint32_t material;
+	uint32_t mesh;
+	float depth;
+};
+//same rebinding rules as the forward pass
+template<typename Order>
+static void CountChanges(const std::vector<Draw>& draws, Order&& order, uint32_t& shaders, uint32_t& materials)
+{
+	uint32_t boundShader = UINT32_MAX, boundMaterial = UINT32_MAX;
+	shaders = materials = 0;
+	for (uint32_t i = 0; i < draws.size(); i++)
+	{
+		const Draw& d = draws[order(i)];
+		if (d.shader != boundShader) { boundShader = d.shader; boundMaterial = UINT32_MAX; shaders++; }
+		if (d.material != boundMaterial) { boundMaterial = d.material; materials++; }
+	}
+}
+/*
+* Stand in for a graphics command list, every command is written out the way a recorder would,
+* so the timings are about the CPU work a pass does per draw
+*/
+struct Command
+{
+	uint32_t type;
+	uint32_t args[4];
+};
+struct Recorder
+{
+	std::vector<Command> commands;
+	void Record(uint32_t type, uint32_t a, uint32_t b = 0, uint32_t c = 0, uint32_t d = 0) { commands.push_back({ type, { a, b, c, d } }); }
+};
+enum : uint32_t { BindShader, BindMaterial, BindObject, PushConstant, DrawIndexed, DrawIndexedIndirect };
+struct InstancingResult
+{
+	uint32_t draws;
+	double recordMs;
+};
+//forward pass rebinding rules, every draw binds its object slot through a dynamic offset
+static InstancingResult RecordPerObject(const std::vector<Draw>& draws, const RenderQueue& queue, Recorder& recorder)
+{
+	InstancingResult result{};
+	result.recordMs = Time(numIterations, [&]()
+		{
+			recorder.commands.clear();
+			uint32_t boundShader = UINT32_MAX, boundMaterial = UINT32_MAX;
+			for (const auto& item : queue.GetItems())
+			{
+				const Draw& d = draws[(uint32_t)item.entity];
+				if (d.shader != boundShader) { recorder.Record(BindShader, d.shader); boundShader = d.shader; boundMaterial = UINT32_MAX; }
+				if (d.material != boundMaterial) { recorder.Record(BindMaterial, d.material); boundMaterial = d.material; }
+				recorder.Record(BindObject, (uint32_t)item.entity * 256);
+				recorder.Record(DrawIndexed, d.mesh, 1);
+			}
+		});
+	result.draws = queue.Size();
+	return result;
+}
+//same pass over the batches, the instance ids are written once and each batch pushes its first instance
+static InstancingResult RecordInstanced(const std::vector<Draw>& draws, RenderQueue& queue, Recorder& recorder, std::vector<uint32_t>& instanceObjects)
+{
+	InstancingResult result{};
+	result.recordMs = Time(numIterations, [&]()
+		{
+			queue.BuildBatches();
+			instanceObjects.clear();
+			for (const auto& item : queue.GetItems()) instanceObjects.push_back((uint32_t)item.entity);
+			recorder.commands.clear();
+			uint32_t boundShader = UINT32_MAX, boundMaterial = UINT32_MAX;
+			for (const auto& batch : queue.GetBatches())
+			{
+				const Draw& d = draws[(uint32_t)queue.GetItems()[batch.first].entity];
+				if (d.shader != boundShader) { recorder.Record(BindShader, d.shader); boundShader = d.shader; boundMaterial = UINT32_MAX; }
+				if (d.material != boundMaterial) { recorder.Record(BindMaterial, d.material); boundMaterial = d.material; }
+				recorder.Record(PushConstant, batch.first);
+				recorder.Record(DrawIndexed, d.mesh, batch.count);
+			}
+		});
+	result.draws = (uint32_t)queue.GetBatches().size();
+	return result;
+}
+//one argument record per batch, written the way the scene does, then the first record and a call per material
+static InstancingResult RecordIndirect(const std::vector<Draw>& draws, RenderQueue& queue, Recorder& recorder, std::vector<DrawRecord>& args)
+{
+	InstancingResult result{};
+	result.recordMs = Time(numIterations, [&]()
+		{
+			queue.BuildBatches();
+			args.clear();
+			for (const auto& batch : queue.GetBatches())
+			{
+				const Draw& d = draws[(uint32_t)queue.GetItems()[batch.first].entity];
+				//stand in for the allocator offsets of the mesh
+				args.push_back({ { 36, batch.count, d.mesh * 36, (int32_t)(d.mesh * 24), 0 }, batch.first });
+			}
+			recorder.commands.clear();
+			std::span<const RenderQueue::Batch> batches = queue.GetBatches();
+			uint32_t boundShader = UINT32_MAX;
+			for (uint32_t b = 0; b < batches.size();)
+			{
+				const Draw& d = draws[(uint32_t)queue.GetItems()[batches[b].first].entity];
+				uint32_t end = b + 1;
+				while (end < batches.size() && draws[(uint32_t)queue.GetItems()[batches[end].first].entity].material == d.material) end++;
+				if (d.shader != boundShader) { recorder.Record(BindShader, d.shader); boundShader = d.shader; }
+				recorder.Record(BindMaterial, d.material);
+				recorder.Record(PushConstant, b);
+				recorder.Record(DrawIndexedIndirect, b * (uint32_t)sizeof(DrawRecord), end - b);
+				b = end;
+			}
+		});
+	result.draws = (uint32_t)std::count_if(recorder.commands.begin(), recorder.commands.end(),
+		[](const Command& c) { return c.type == DrawIndexedIndirect; });
+	return result;
+}
+//every instance has to be drawn exactly once, with its own object
+static bool CoversEveryInstance(const RenderQueue& queue, const std::vector<Draw>& draws, const std::vector<uint32_t>& instanceObjects)
+{
+	std::vector<uint32_t> seen(draws.size(), 0);
+	for (const auto& batch : queue.GetBatches())
+	{
+		const Draw& first = draws[(uint32_t)queue.GetItems()[batch.first].entity];
+		for (uint32_t i = batch.first; i < batch.first + batch.count; i++)
+		{
+			const Draw& d = draws[instanceObjects[i]];
+			if (d.mesh != first.mesh || d.material != first.material) return false;
+			seen[instanceObjects[i]]++;
+		}
+	}
+	return std::all_of(seen.begin(), seen.end(), [](uint32_t n) { return n == 1; });
+}
+//what the vertex shader sees, every draw of a call finds its record at the pushed first record plus its draw index
+static bool IndirectCoversEveryInstance(const Recorder& recorder, const std::vector<DrawRecord>& args, uint32_t count)
+{
+	std::vector<uint32_t> seen(count, 0);
+	uint32_t firstRecord = 0;
+	for (const Command& c : recorder.commands)
+	{
+		if (c.type == PushConstant) firstRecord = c.args[0];
+		if (c.type != DrawIndexedIndirect) continue;
+		if (c.args[0] != firstRecord * sizeof(DrawRecord)) return false;
+		for (uint32_t drawIndex = 0; drawIndex < c.args[1]; drawIndex++)
+		{
+			const DrawRecord& record = args[firstRecord + drawIndex];
+			for (uint32_t i = 0; i < record.args.instanceCount; i++) seen[record.instanceBase + i]++;
+		}
+	}
+	return std::all_of(seen.begin(), seen.end(), [](uint32_t n) { return n == 1; });
+}
+static bool RunInstancing()
+{
+	std::mt19937 rng(7);
+	std::vector<Draw> draws(numInstances);
+	for (auto& d : draws)
+	{
+		d.material = std::uniform_int_distribution<uint32_t>(0, numInstancedMaterials - 1)(rng);
+		d.shader = d.material % numShaders;
+		d.mesh = std::uniform_int_distribution<uint32_t>(0, numInstancedMeshes - 1)(rng);
+		d.depth = std::uniform_real_distribution<float>(0.1f, 500.f)(rng);
+	}
+	RenderQueue queue;
+	for (uint32_t i = 0; i < numInstances; i++)
+	{
+		const Draw& d = draws[i];
+		uint32_t depth = RenderQueue::QuantizeDepth(d.depth, 0.1f, 500.f);
+		queue.Push(RenderQueue::StateKey(RenderQueue::Pass::Opaque, d.shader, d.material, d.mesh, depth), (entt::entity)i,
+			((uint64_t)d.material << 32) | d.mesh);
+	}
+	queue.Sort();
+	Recorder recorder;
+	std::vector<uint32_t> instanceObjects;
+	InstancingResult perObject = RecordPerObject(draws, queue, recorder);
+	uint32_t perObjectCommands = (uint32_t)recorder.commands.size();
+	InstancingResult instanced = RecordInstanced(draws, queue, recorder, instanceObjects);
+	uint32_t instancedCommands = (uint32_t)recorder.commands.size();
+	bool covered = CoversEveryInstance(queue, draws, instanceObjects);
+	std::vector<DrawRecord> args;
+	InstancingResult indirect = RecordIndirect(draws, queue, recorder, args);
+	uint32_t indirectCommands = (uint32_t)recorder.commands.size();
+	bool indirectCovered = IndirectCoversEveryInstance(recorder, args, numInstances);
+	uint32_t argInstances = 0;
+	for (const auto& a : args) argInstances += a.args.instanceCount;
+	printf("%u instances, %u meshes, %u materials\n", numInstances, numInstancedMeshes, numInstancedMaterials);
+	printf("  one draw per mesh:  %6u draws, %6u commands, record %8.3f ms\n", perObject.draws, perObjectCommands, perObject.recordMs);
+	printf("  instanced batches:  %6u draws, %6u commands, record %8.3f ms (batching and instance ids included, %s)\n",
+		instanced.draws, instancedCommands, instanced.recordMs, covered ? "every instance drawn once" : "INSTANCES WRONG");
+	printf("  indirect:           %6u calls, %6u commands, record %8.3f ms (%u argument records, %s)\n",
+		indirect.draws, indirectCommands, indirect.recordMs, (uint32_t)args.size(), indirectCovered ? "every instance drawn once" : "INSTANCES WRONG");
+	return covered && indirectCovered && argInstances == numInstances;
+}
+//every (caster, cascade) pair becomes one instance, the batches of each layout must hold exactly those with one mesh per batch
+static bool CoversEveryCascade(const RenderQueue& queue, const std::vector<Draw>& casters, const std::vector<uint32_t>& masks, bool cascadeInKey)
+{
+	std::vector<uint32_t> seen(casters.size(), 0);
+	for (const auto& batch : queue.GetBatches())
+	{
+		uint32_t mesh = casters[(uint32_t)queue.GetItems()[batch.first].entity].mesh;
+		for (uint32_t i = batch.first; i < batch.first + batch.count; i++)
+		{
+			const auto& item = queue.GetItems()[i];
+			uint32_t cascade = cascadeInKey ? (uint32_t)(item.key & 0xffff) : (uint32_t)(item.key >> 16) & 0xffff;
+			if (casters[(uint32_t)item.entity].mesh != mesh || seen[(uint32_t)item.entity] & (1u << cascade)) return false;
+			seen[(uint32_t)item.entity] |= 1u << cascade;
+		}
+	}
+	return seen == masks;
+}
+static bool RunCascades()
+{
+	std::mt19937 rng(11);
+	std::vector<Draw> casters(numCasters);
+	std::vector<uint32_t> masks(numCasters);
+	for (uint32_t i = 0; i < numCasters; i++)
+	{
+		casters[i].mesh = std::uniform_int_distribution<uint32_t>(0, numInstancedMeshes - 1)(rng);
+		//cascades are nested slices of the view, a caster touches a run of neighbouring ones
+		uint32_t first = std::uniform_int_distribution<uint32_t>(0, numCascades - 1)(rng);
+		uint32_t count = std::uniform_int_distribution<uint32_t>(1, numCascades - first)(rng);
+		masks[i] = ((1u << count) - 1) << first;
+	}
+	RenderQueue perCascade, singlePass;
+	Recorder recorder;
+	double perCascadeMs = Time(numIterations, [&]()
+		{
+			perCascade.Clear();
+			for (uint32_t i = 0; i < numCasters; i++)
+				for (uint32_t c = 0; c < numCascades; c++)
+					if (masks[i] & (1u << c)) perCascade.Push(RenderQueue::ListKey(RenderQueue::Pass::Shadow, c, casters[i].mesh), (entt::entity)i, ((uint64_t)c << 32) | casters[i].mesh);
+			perCascade.Sort();
+			perCascade.BuildBatches();
+			//a viewport per cascade, the cascade and first record pushed for one indirect call per cascade
+			recorder.commands.clear();
+			std::span<const RenderQueue::Batch> batches = perCascade.GetBatches();
+			for (uint32_t b = 0; b < batches.size();)
+			{
+				uint32_t cascade = (uint32_t)(perCascade.GetItems()[batches[b].first].key >> 16) & 0xffff;
+				uint32_t end = b + 1;
+				while (end < batches.size() && ((perCascade.GetItems()[batches[end].first].key >> 16) & 0xffff) == cascade) end++;
+				recorder.Record(BindObject, cascade);
+				recorder.Record(PushConstant, b);
+				recorder.Record(DrawIndexedIndirect, b * (uint32_t)sizeof(DrawRecord), end - b);
+				b = end;
+			}
+		});
+	uint32_t perCascadeCommands = (uint32_t)recorder.commands.size();
+	double singlePassMs = Time(numIterations, [&]()
+		{
+			singlePass.Clear();
+			for (uint32_t i = 0; i < numCasters; i++)
+				for (uint32_t c = 0; c < numCascades; c++)
+					if (masks[i] & (1u << c)) singlePass.Push(RenderQueue::ListSubKey(RenderQueue::Pass::Shadow, 0, casters[i].mesh, c), (entt::entity)i, casters[i].mesh);
+			singlePass.Sort();
+			singlePass.BuildBatches();
+			recorder.commands.clear();
+			std::span<const RenderQueue::Batch> batches = singlePass.GetBatches();
+			recorder.Record(PushConstant, 0);
+			recorder.Record(DrawIndexedIndirect, 0, (uint32_t)batches.size());
+		});
+	uint32_t singlePassCommands = (uint32_t)recorder.commands.size();
+	bool covered = CoversEveryCascade(perCascade, casters, masks, false) && CoversEveryCascade(singlePass, casters, masks, true);
+	printf("%u shadow casters over %u cascades, %u caster instances\n", numCasters, numCascades, singlePass.Size());
+	printf("  list per cascade:   %6u records, %6u commands, build and record %8.3f ms\n", (uint32_t)perCascade.GetBatches().size(), perCascadeCommands, perCascadeMs);
+	printf("  single pass:        %6u records, %6u commands, build and record %8.3f ms (%s)\n", (uint32_t)singlePass.GetBatches().size(), singlePassCommands, singlePassMs,
+		covered ? "every cascade of every caster drawn once" : "INSTANCES WRONG");
+	return covered;
+}
+int main()
+{
+	std::mt19937 rng(3);
+	std::vector<Draw> draws(numDraws);
+	for (auto& d : draws)
+	{
+		d.material = std::uniform_int_distribution<uint32_t>(0, numMaterials - 1)(rng);
+		d.shader = d.material % numShaders;//materials own their shader
+		d.mesh = std::uniform_int_distribution<uint32_t>(0, numMeshes - 1)(rng);
+		d.depth = std::uniform_real_distribution<float>(0.1f, 500.f)(rng);
+	}
+	RenderQueue queue;
+	auto build = [&]()
+		{
+			queue.Clear();
+			for (uint32_t i = 0; i < numDraws; i++)
+			{
+				const Draw& d = draws[i];
+				uint32_t depth = RenderQueue::QuantizeDepth(d.depth, 0.1f, 500.f);
+				queue.Push(RenderQueue::StateKey(RenderQueue::Pass::Opaque, d.shader, d.material, d.mesh, depth), (entt::entity)i);
+			}
+		};
+	build();
+	std::vector<RenderQueue::Item> reference(queue.GetItems().begin(), queue.GetItems().end());
+	std::stable_sort(reference.begin(), reference.end(), [](const auto& a, const auto& b) { return a.key < b.key; });
+	queue.Sort();
+	bool identical = std::equal(reference.begin(), reference.end(), queue.GetItems().begin(),
+		[](const auto& a, const auto& b) { return a.key == b.key && a.entity == b.entity; });
+
+	double radix = Time(numIterations, [&]() { build(); queue.Sort(); });
+	std::vector<RenderQueue::Item> items;
+	double stdSort = Time(numIterations, [&]()
+		{
+			build();
+			items.assign(queue.GetItems().begin(), queue.GetItems().end());
+			std::stable_sort(items.begin(), items.end(), [](const auto& a, const auto& b) { return a.key < b.key; });
+		});
+	double buildOnly = Time(numIterations, build);
+	build();
+	queue.Sort();
+
+	uint32_t shadersBefore, materialsBefore, shadersAfter, materialsAfter;
+	CountChanges(draws, [](uint32_t i) { return i; }, shadersBefore, materialsBefore);
+	CountChanges(draws, [&](uint32_t i) { return (uint32_t)queue.GetItems()[i].entity; }, shadersAfter, materialsAfter);
+	printf("%u draws, %u shaders, %u materials, %u meshes\n", numDraws, numShaders, numMaterials, numMeshes);
+	printf("  visibility order: %6u pipeline switches, %6u material switches\n", shadersBefore, materialsBefore);
+	printf("  sorted:           %6u pipeline switches, %6u material switches\n", shadersAfter, materialsAfter);
+	printf("  key build %8.3f ms, radix sort %8.3f ms, std::stable_sort %8.3f ms (order %s)\n",
+		buildOnly, radix - buildOnly, stdSort - buildOnly, identical ? "identical" : "DIFFERS");
+	bool instancing = RunInstancing();
+	bool cascades = RunCascades();
+	return identical && instancing && cascades ? 0 : 1;
+}
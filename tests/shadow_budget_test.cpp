@@ -0,0 +1,126 @@
+/*
+* Checks the shadow resolution tiers picked from screen coverage: the coverage estimate, tiers following the footprint,
+* the texel budget being met by dropping the least covered lights first, and hysteresis keeping lights whose footprint
+* wobbles around a tier boundary on the region they have. A walk past a street of lights counts the reallocations.
+*/
+#include "Pistachio/Scene/ShadowBudget.h"
+#include "test_utils.h"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace Pistachio;
+static constexpr uint32_t screenPixels = 1920 * 1080;
+static constexpr float aspect = 1920.f / 1080.f;
+static const float tanHalfFov = std::tan(0.5f * 1.0472f);//60 degrees
+
+static uint32_t Coverage()
+{
+	uint32_t failures = 0;
+	printf("coverage\n");
+	failures += Expect("camera inside the light", ShadowBudget::ScreenCoverage(0, 0, 1, 5, tanHalfFov, aspect) == 1.f);
+	failures += Expect("light behind the camera", ShadowBudget::ScreenCoverage(0, 0, -20, 5, tanHalfFov, aspect) == 0.f);
+	float near = ShadowBudget::ScreenCoverage(0, 0, 20, 1, tanHalfFov, aspect);
+	float far = ShadowBudget::ScreenCoverage(0, 0, 40, 1, tanHalfFov, aspect);
+	failures += Expect("twice as far covers about a quarter", std::abs(far / near - 0.25f) < 0.01f);
+	return failures;
+}
+static uint32_t Tiers()
+{
+	uint32_t failures = 0;
+	printf("tiers\n");
+	ShadowBudget::Settings settings;
+	std::vector<ShadowBudget::Request> requests;
+	for (float coverage : { 0.0001f, 0.01f, 0.05f, 0.2f, 1.f }) requests.push_back({ coverage, 1, 1, 0 });
+	requests.push_back({ 0.2f, 3, 2, 0 });//a point light splits its texels over 6 faces
+	std::vector<uint32_t> sizes(requests.size());
+	ShadowBudget::Assign(settings, screenPixels, requests, sizes);
+	printf("  sizes:");
+	for (uint32_t s : sizes) printf(" %u", s);
+	printf("\n");
+	failures += Expect("tiny light gets the smallest tier", sizes[0] == settings.minSize);
+	failures += Expect("full screen light gets the biggest tier", sizes[4] == settings.maxSize);
+	bool monotonic = true;
+	for (uint32_t i = 1; i < 5; i++) monotonic &= sizes[i] >= sizes[i - 1];
+	failures += Expect("tiers grow with coverage", monotonic);
+	failures += Expect("point light faces are smaller than a spot light's", sizes[5] < sizes[3]);
+	return failures;
+}
+static uint32_t Budget()
+{
+	uint32_t failures = 0;
+	printf("budget\n");
+	ShadowBudget::Settings settings;
+	settings.texelBudget = 4096ull * 4096ull * 3 / 4;
+	std::vector<ShadowBudget::Request> requests;
+	for (uint32_t i = 0; i < 64; i++) requests.push_back({ 0.5f / (1.f + i * 0.25f), i % 3 ? 1u : 3u, i % 3 ? 1u : 2u, 0 });
+	std::vector<uint32_t> sizes(requests.size());
+	settings.texelBudget = UINT64_MAX;
+	uint64_t unbounded = ShadowBudget::Assign(settings, screenPixels, requests, sizes);
+	settings.texelBudget = 4096ull * 4096ull * 3 / 4;
+	uint64_t total = ShadowBudget::Assign(settings, screenPixels, requests, sizes);
+	printf("  64 lights want %llu texels, budget %llu, assigned %llu\n", (unsigned long long)unbounded,
+		(unsigned long long)settings.texelBudget, (unsigned long long)total);
+	failures += Expect("assigned texels fit the budget", total <= settings.texelBudget);
+	//among lights with the same shape, a better covered one never ends up smaller
+	bool ordered = true;
+	for (uint32_t i = 0; i < requests.size(); i++)
+		for (uint32_t j = i + 1; j < requests.size(); j++)
+			if (requests[i].tilesX == requests[j].tilesX && sizes[i] < sizes[j]) ordered = false;
+	failures += Expect("better covered lights keep at least the same tier", ordered);
+	//a budget nothing fits in leaves every light at the smallest tier
+	settings.texelBudget = 1;
+	ShadowBudget::Assign(settings, screenPixels, requests, sizes);
+	bool allMin = true;
+	for (uint32_t s : sizes) allMin &= s == settings.minSize;
+	failures += Expect("an impossible budget bottoms out at the smallest tier", allMin);
+	return failures;
+}
+//a light's size over frames, counting the frames its tier changes
+static uint32_t CountChanges(const ShadowBudget::Settings& settings, const std::vector<float>& coverage)
+{
+	uint32_t size = 0, changes = 0;
+	for (float c : coverage)
+	{
+		ShadowBudget::Request request{ c, 1, 1, size };
+		uint32_t next;
+		ShadowBudget::Assign(settings, screenPixels, { &request, 1 }, { &next, 1 });
+		if (size && next != size) changes++;
+		size = next;
+	}
+	return changes;
+}
+static uint32_t Hysteresis()
+{
+	uint32_t failures = 0;
+	printf("hysteresis\n");
+	ShadowBudget::Settings settings;
+	ShadowBudget::Settings noHysteresis = settings;
+	noHysteresis.hysteresis = 0.f;
+	//512 is tier 9, the rounding point to 1024 is at tier 9.5, the footprint wobbles 10% around it
+	float boundary = std::pow(2.f, 19.f) / screenPixels;
+	std::vector<float> wobble;
+	for (uint32_t frame = 0; frame < 120; frame++) wobble.push_back(boundary * (frame & 1 ? 1.1f : 0.9f));
+	uint32_t with = CountChanges(settings, wobble), without = CountChanges(noHysteresis, wobble);
+	printf("  footprint wobbling around a boundary for 120 frames: %u reallocations, %u without hysteresis\n", with, without);
+	failures += Expect("a wobbling light keeps its region", with == 0 && without > 0);
+	//walking down a street, every light passes through all the tiers once
+	std::vector<float> walk;
+	for (uint32_t frame = 0; frame < 600; frame++)
+	{
+		float distance = std::abs(60.f - frame * 0.2f) + 2.f;
+		//a bit of noise from the camera bobbing
+		distance *= 1.f + 0.05f * std::sin(frame * 0.9f);
+		walk.push_back(ShadowBudget::ScreenCoverage(0, 0, distance, 3.f, tanHalfFov, aspect));
+	}
+	with = CountChanges(settings, walk);
+	without = CountChanges(noHysteresis, walk);
+	printf("  walking past a light for 600 frames: %u reallocations, %u without hysteresis\n", with, without);
+	failures += Expect("hysteresis cuts the reallocations of a walk past a light", with < without);
+	return failures;
+}
+int main()
+{
+	uint32_t failures = Coverage() + Tiers() + Budget() + Hysteresis();
+	return failures ? 1 : 0;
+}
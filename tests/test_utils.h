@@ -0,0 +1,23 @@
+/*
+* Helpers shared by the standalone tests and benchmarks, every one of them is a single file with its own main.
+*/
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+//prints one check of a test, returns 1 for a failure so the results can be summed into the exit code
+static inline uint32_t Expect(const char* name, bool ok)
+{
+	printf("  %-64s %s\n", name, ok ? "ok" : "FAILED");
+	return !ok;
+}
+//average milliseconds of one call to @fn over @iterations calls
+template<typename Fn>
+static double Time(uint32_t iterations, Fn&& fn)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+	for (uint32_t i = 0; i < iterations; i++) fn();
+	auto end = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}